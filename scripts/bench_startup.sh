@@ -0,0 +1,48 @@
+#!/bin/sh
+# Measures process start-up for each binary: every run launches the program
+# with -h, which prints usage and exits before any window or file is opened.
+#
+# Usage: scripts/bench_startup.sh [runs] [binary...]
+
+RUNS=${1:-200}
+[ $# -gt 0 ] && shift
+BINS=${*:-"hex_editor checksum mirageisland pokemon_bag pokemon_party"}
+
+# date +%s%N is GNU-only (BSD and macOS print a literal N), so the runs are
+# timed by python3's monotonic clock. One interpreter launches all of them,
+# so its own start-up stays out of the numbers.
+if ! command -v python3 > /dev/null 2>&1; then
+    echo "Error: python3 is needed for the timer" >&2
+    exit 1
+fi
+
+# Prints the first run's time and the total time of RUNS more, in ns
+time_runs() {
+    python3 - "$1" "$2" <<'PY'
+import subprocess, sys, time
+
+def run():
+    subprocess.run([sys.argv[1], "-h"], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+
+start = time.monotonic_ns()
+run()
+first = time.monotonic_ns() - start
+
+start = time.monotonic_ns()
+for _ in range(int(sys.argv[2])):
+    run()
+print(first, time.monotonic_ns() - start)
+PY
+}
+
+printf '%-16s %12s %12s\n' "binary" "first (ms)" "avg (ms)"
+for bin in $BINS; do
+    if [ ! -x "./$bin" ]; then
+        echo "Error: ./$bin not found, run make first" >&2
+        exit 1
+    fi
+
+    set -- $(time_runs "./$bin" "$RUNS")
+    awk -v b="$bin" -v f="$1" -v t="$2" -v n="$RUNS" \
+        'BEGIN { printf "%-16s %12.3f %12.3f\n", b, f / 1e6, t / n / 1e6 }'
+done
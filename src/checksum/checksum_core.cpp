@@ -0,0 +1,962 @@
+#include "checksum_core.h"
+#include "../common/checksum_kernels.h"
+#include "../common/game_detect.h"
+#include "../common/game_layouts.h"
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+
+// ============================================================================
+// Constructor
+// ============================================================================
+
+ChecksumCore::ChecksumCore()
+    : fileSize(0), 
+      gameMode(GAME_POKEMON_RED_BLUE),
+      isJapanese(false), 
+      shouldWrite(false), shouldOverwrite(false),
+      redBlueBank1Sum(0), redBlueBank1Checksum(0), redBlueBank1StoredChecksum(0),
+      redBlueBank1ChecksumLocation(0), 
+      redBlueBank1Start(0), redBlueBank1End(0), redBlueBank1Matches(false),
+      goldSilverTotalSum1(0), goldSilverTotalSum2(0),
+      goldSilverChecksum1(0), goldSilverChecksum2(0),
+      goldSilverStoredChecksum1(0), goldSilverStoredChecksum2(0),
+      goldSilverChecksum1Location(0), goldSilverChecksum2Location(0),
+      goldSilverStart1(0), goldSilverEnd1(0),
+      goldSilverChecksum1Matches(false), goldSilverChecksum2Matches(false),
+      crystalTotalSum1(0), crystalTotalSum2(0),
+      crystalChecksum1(0), crystalChecksum2(0),
+      crystalStoredChecksum1(0), crystalStoredChecksum2(0),
+      crystalChecksum1Location(0), crystalChecksum2Location(0),
+      crystalStart1(0), crystalEnd1(0), 
+      crystalStart2(0), crystalEnd2(0),
+      crystalChecksum1Matches(false), crystalChecksum2Matches(false),
+      gen3SaveAIsCurrent(false),
+      pokemonChecksumMode(false),
+      pokemonRepairCount(0),
+      verbose(true),
+      reportStream(&std::cout),
+      errorStream(&std::cerr),
+      nullStream(nullptr) {
+    
+    memset(&redBlueBank2, 0, sizeof(redBlueBank2));
+    memset(&redBlueBank3, 0, sizeof(redBlueBank3));
+    memset(&gen3SaveA, 0, sizeof(gen3SaveA));
+    memset(&gen3SaveB, 0, sizeof(gen3SaveB));
+}
+
+// ============================================================================
+// Low-level Buffer Read/Write Helpers
+// ============================================================================
+
+uint8_t ChecksumCore::readU8(size_t offset) const {
+    return DataUtils::readU8(fileBuffer, offset);
+}
+
+uint16_t ChecksumCore::readU16LE(size_t offset) const {
+    return DataUtils::readU16LE(fileBuffer, offset);
+}
+
+uint32_t ChecksumCore::readU32LE(size_t offset) const {
+    return DataUtils::readU32LE(fileBuffer, offset);
+}
+
+void ChecksumCore::patchU8(size_t offset, uint8_t value) {
+    if (readU8(offset) == value) return;
+    DataUtils::writeU8(fileBuffer, offset, value);
+    filePatches.add(offset, 1);
+}
+
+void ChecksumCore::patchU16LE(size_t offset, uint16_t value) {
+    if (readU16LE(offset) == value) return;
+    DataUtils::writeU16LE(fileBuffer, offset, value);
+    filePatches.add(offset, 2);
+}
+
+// ============================================================================
+// Pokemon Data Structure Helpers (for Gen 3)
+// ============================================================================
+
+uint16_t ChecksumCore::calculatePokemonDataChecksum(size_t pokemonBaseAddr, uint32_t decryptionKey) const {
+    return Generation3Utils::calculatePokemonDataChecksum(fileBuffer, pokemonBaseAddr, decryptionKey);
+}
+
+// ============================================================================
+// Public Interface Functions
+// ============================================================================
+
+bool ChecksumCore::loadFile(const char* filename) {
+    // Verification only reads, so the file is never copied; -w only
+    // duplicates the pages it patches
+    MappedFile::Mode mode = shouldWrite ? MappedFile::Mode::CopyOnWrite : MappedFile::Mode::ReadOnly;
+    if (!HexUtils::loadFileToBuffer(filename, fileBuffer, fileSize, mode)) {
+        err() << "Failed to open: " << filename << std::endl;
+        return false;
+    }
+    fileName = filename;
+    return true;
+}
+
+void ChecksumCore::setWriteMode(bool write) {
+    shouldWrite = write;
+    if (shouldWrite && !fileBuffer.empty()) {
+        fileBuffer.makeWritable();
+    }
+}
+
+bool ChecksumCore::setGame(const std::string& game) {
+    std::string g = game;
+    std::transform(g.begin(), g.end(), g.begin(), ::tolower);
+    
+    if (g == GameDetect::AUTO_GAME) {
+        GameDetect::Result detected = GameDetect::detect(fileBuffer);
+        if (!detected.found()) {
+            err() << "Could not detect the game of " << fileName << "; pass it explicitly" << std::endl;
+            return false;
+        }
+        out() << "Detected game: " << detected.description << (detected.japanese ? " (Japanese)" : "") << std::endl;
+        isJapanese = detected.japanese;
+        return setGame(detected.game);
+    }
+    
+    if (g == "red" || g == "blue" || g == "yellow" || g == "green" || 
+        g == "pokemon_red" || g == "pokemon_blue" || g == "pokemon_yellow" ||
+        g == "pokemon_red_blue" || g == "redblue") {
+        gameMode = GAME_POKEMON_RED_BLUE;
+        if (g == "yellow" || g == "pokemon_yellow") {
+            gameName = "Pokemon Yellow";
+        } else {
+            gameName = "Pokemon Red/Blue/Green";
+        }
+    } else if (g == "gold" || g == "silver" || g == "pokemon_gold" || g == "pokemon_silver" ||
+               g == "pokemon_gold_silver" || g == "goldsilver") {
+        gameMode = GAME_POKEMON_GOLD_SILVER;
+        gameName = "Pokemon Gold/Silver";
+    } else if (g == "crystal" || g == "pokemon_crystal") {
+        gameMode = GAME_POKEMON_CRYSTAL;
+        gameName = "Pokemon Crystal";
+    } else if (g == "ruby" || g == "pokemon_ruby") {
+        gameMode = GAME_POKEMON_GENERATION3;
+        gameName = "Pokemon Ruby";
+    } else if (g == "sapphire" || g == "pokemon_sapphire") {
+        gameMode = GAME_POKEMON_GENERATION3;
+        gameName = "Pokemon Sapphire";
+    } else if (g == "emerald" || g == "pokemon_emerald") {
+        gameMode = GAME_POKEMON_GENERATION3;
+        gameName = "Pokemon Emerald";
+    } else if (g == "firered" || g == "fire_red" || g == "pokemon_firered" || g == "pokemon_fire_red") {
+        gameMode = GAME_POKEMON_GENERATION3;
+        gameName = "Pokemon FireRed";
+    } else if (g == "leafgreen" || g == "leaf_green" || g == "pokemon_leafgreen" || g == "pokemon_leaf_green") {
+        gameMode = GAME_POKEMON_GENERATION3;
+        gameName = "Pokemon LeafGreen";
+    } else if (g == "gen3" || g == "generation3" || g == "generation_3") {
+        gameMode = GAME_POKEMON_GENERATION3;
+        gameName = "Pokemon Generation 3";
+    } else {
+        err() << "Unknown game: " << game << std::endl;
+        err() << "Supported games: red, blue, yellow, green, gold, silver, crystal, ruby, sapphire, emerald, firered, leafgreen, auto" << std::endl;
+        return false;
+    }
+    
+    if (isJapanese) {
+        if (gameMode == GAME_POKEMON_CRYSTAL || gameMode == GAME_POKEMON_RED_BLUE || gameMode == GAME_POKEMON_GOLD_SILVER) {
+            gameName += " (Japanese)";
+        } else {
+            out() << "Note: Japanese version has no known checksum difference for " << gameName << std::endl;
+            out() << "Proceeding with regular checksum calculation." << std::endl;
+        }
+    }
+    
+    return true;
+}
+
+bool ChecksumCore::calculateChecksum() {
+    if (pokemonChecksumMode) {
+        if (!calculatePokemonChecksum()) {
+            return false;
+        }
+        if (shouldWrite) {
+            // Repair mode: fix the Pokemon, then write them with fresh section checksums
+            repairPokemonChecksums();
+            return writeChecksumsToFile();
+        }
+        return true;
+    }
+    
+    bool result = false;
+    switch (gameMode) {
+        case GAME_POKEMON_RED_BLUE:
+            result = calculateChecksumPokemonRedBlue();
+            break;
+        case GAME_POKEMON_GOLD_SILVER:
+            result = calculateChecksumPokemonGoldSilver();
+            break;
+        case GAME_POKEMON_CRYSTAL:
+            result = calculateChecksumPokemonCrystal();
+            break;
+        case GAME_POKEMON_GENERATION3:
+            result = calculateChecksumPokemonGeneration3();
+            break;
+        default:
+            err() << "Unknown game mode" << std::endl;
+            return false;
+    }
+    
+    if (result && shouldWrite) {
+        return writeChecksumsToFile();
+    }
+    
+    return result;
+}
+
+// ============================================================================
+// Game-Specific Checksum Calculation Functions
+// ============================================================================
+
+bool ChecksumCore::calculateChecksumPokemonRedBlue() {
+    const GameLayouts::GameLayout& layout = GameLayouts::get(
+        GameLayouts::layoutOf(GameLayouts::Game::GEN1, isJapanese));
+    const GameLayouts::Checksum& bank1 = layout.checksums[0];
+    const GameLayouts::BoxBanks& boxBanks = layout.boxBanks;
+    static_assert(GameLayouts::GEN1_BOX_BANKS.bankCount == 2, "Gen 1 has box banks 2 and 3");
+    redBlueBank1Start = bank1.ranges[0].start;
+    redBlueBank1End = bank1.ranges[0].end;
+    redBlueBank1ChecksumLocation = bank1.location;
+    
+    // The last bank's checksums sit furthest into the file
+    size_t lastBase = boxBanks.bases[boxBanks.bankCount - 1];
+    size_t required = lastBase + boxBanks.whole.location + 1;
+    for (size_t i = 0; i < boxBanks.boxCount; i++) {
+        required = std::max<size_t>(required, lastBase + boxBanks.boxes[i].location + 1);
+    }
+    if (required > fileSize) {
+        err() << "Error: Address out of range (file size: 0x" 
+                  << std::hex << fileSize << ", need at least 0x" << required << ")" << std::endl;
+        return false;
+    }
+    
+    out() << "\n=== Pokemon Red/Blue Checksum Calculation ===" << std::endl;
+    out() << "File: " << fileName << " (" << std::dec << fileSize << " bytes)" << std::endl;
+    
+    // Bank 1
+    out() << "\n--- Bank 1 ---" << std::endl;
+    out() << "Range: 0x" << HexUtils::toHexString(redBlueBank1Start, 4) 
+              << " - 0x" << HexUtils::toHexString(redBlueBank1End, 4) << std::endl;
+    
+    redBlueBank1Checksum = calculateRedBlue8BitChecksum(redBlueBank1Start, redBlueBank1End, redBlueBank1Sum);
+    redBlueBank1StoredChecksum = readU8(redBlueBank1ChecksumLocation);
+    redBlueBank1Matches = (redBlueBank1Checksum == redBlueBank1StoredChecksum);
+    
+    out() << "Sum: 0x" << std::hex << redBlueBank1Sum << std::endl;
+    out() << "Checksum: calc=0x" << HexUtils::toHexString(redBlueBank1Checksum, 2)
+              << " stored=0x" << HexUtils::toHexString(redBlueBank1StoredChecksum, 2)
+              << " @ 0x" << HexUtils::toHexString(redBlueBank1ChecksumLocation, 4)
+              << (redBlueBank1Matches ? " OK" : " MISMATCH") << std::endl;
+    
+    // Banks 2 and 3 hold the PC boxes
+    out() << "\n--- Bank 2 (base 0x" << HexUtils::toHexString(boxBanks.bases[0], 4) << ") ---" << std::endl;
+    calculateRedBlueBankChecksums(boxBanks, boxBanks.bases[0], redBlueBank2);
+    
+    out() << "\n--- Bank 3 (base 0x" << HexUtils::toHexString(boxBanks.bases[1], 4) << ") ---" << std::endl;
+    calculateRedBlueBankChecksums(boxBanks, boxBanks.bases[1], redBlueBank3);
+    
+    out() << "\n=============================================\n" << std::endl;
+    
+    return true;
+}
+
+bool ChecksumCore::calculateChecksumPokemonGoldSilver() {
+    const GameLayouts::GameLayout& layout = GameLayouts::get(
+        GameLayouts::layoutOf(GameLayouts::Game::GOLD_SILVER, isJapanese));
+    const GameLayouts::Checksum& checksum1 = layout.checksums[0];
+    const GameLayouts::Checksum& checksum2 = layout.checksums[1];
+    
+    goldSilverStart1 = checksum1.ranges[0].start;
+    goldSilverEnd1 = checksum1.ranges[0].end;
+    goldSilverChecksum1Location = checksum1.location;
+    
+    // English saves sum three separate areas for checksum 2, Japanese saves one
+    goldSilverRanges2.clear();
+    for (size_t r = 0; r < checksum2.rangeCount; r++) {
+        goldSilverRanges2.emplace_back(checksum2.ranges[r].start, checksum2.ranges[r].end);
+    }
+    goldSilverChecksum2Location = checksum2.location;
+    
+    // Check file size
+    if (goldSilverChecksum2Location >= fileSize) {
+        err() << "Error: Address out of range (file size: 0x" 
+                  << std::hex << fileSize << ", need at least 0x" << (goldSilverChecksum2Location + 2) << ")" << std::endl;
+        return false;
+    }
+    
+    out() << "\n=== Pokemon Gold/Silver Checksum Calculation";
+    if (isJapanese) out() << " (Japanese)";
+    out() << " ===" << std::endl;
+    out() << "File: " << fileName << " (" << std::dec << fileSize << " bytes)" << std::endl;
+    
+    // First checksum
+    out() << "\n--- Checksum 1 ---" << std::endl;
+    out() << "Range: 0x" << HexUtils::toHexString(goldSilverStart1, 4) 
+              << " - 0x" << HexUtils::toHexString(goldSilverEnd1, 4) << std::endl;
+    out() << "Checksum location: 0x" << HexUtils::toHexString(goldSilverChecksum1Location, 4) << std::endl;
+    
+    goldSilverChecksum1 = calculateGBC16BitChecksum(goldSilverStart1, goldSilverEnd1, goldSilverTotalSum1);
+    goldSilverStoredChecksum1 = readU16LE(goldSilverChecksum1Location);
+    goldSilverChecksum1Matches = (goldSilverChecksum1 == goldSilverStoredChecksum1);
+    
+    out() << "Sum of range: 0x" << std::hex << goldSilverTotalSum1 << std::endl;
+    out() << "*** CHECKSUM 1: calc=0x" << HexUtils::toHexString(goldSilverChecksum1, 4)
+              << " stored=0x" << HexUtils::toHexString(goldSilverStoredChecksum1, 4)
+              << " (bytes: 0x" << formatReversedBytes16(goldSilverChecksum1) << ")"
+              << (goldSilverChecksum1Matches ? " OK" : " MISMATCH") << " ***" << std::endl;
+    
+    // Second checksum
+    if (isJapanese) {
+        out() << "\n--- Checksum 2 ---" << std::endl;
+    } else {
+        out() << "\n--- Checksum 2 (non-contiguous) ---" << std::endl;
+    }
+    
+    for (const auto& range : goldSilverRanges2) {
+        out() << "Range: 0x" << HexUtils::toHexString(range.first, 4) 
+                  << " - 0x" << HexUtils::toHexString(range.second, 4) << std::endl;
+    }
+    out() << "Checksum location: 0x" << HexUtils::toHexString(goldSilverChecksum2Location, 4) << std::endl;
+    
+    goldSilverChecksum2 = calculateGBC16BitChecksumMultiRange(goldSilverRanges2, goldSilverTotalSum2);
+    goldSilverStoredChecksum2 = readU16LE(goldSilverChecksum2Location);
+    goldSilverChecksum2Matches = (goldSilverChecksum2 == goldSilverStoredChecksum2);
+    
+    out() << "Sum of ranges: 0x" << std::hex << goldSilverTotalSum2 << std::endl;
+    out() << "*** CHECKSUM 2: calc=0x" << HexUtils::toHexString(goldSilverChecksum2, 4)
+              << " stored=0x" << HexUtils::toHexString(goldSilverStoredChecksum2, 4)
+              << " (bytes: 0x" << formatReversedBytes16(goldSilverChecksum2) << ")"
+              << (goldSilverChecksum2Matches ? " OK" : " MISMATCH") << " ***" << std::endl;
+    out() << "=============================================\n" << std::endl;
+    
+    return true;
+}
+
+bool ChecksumCore::calculateChecksumPokemonCrystal() {
+    const GameLayouts::GameLayout& layout = GameLayouts::get(
+        GameLayouts::layoutOf(GameLayouts::Game::CRYSTAL, isJapanese));
+    
+    crystalStart1 = layout.checksums[0].ranges[0].start;
+    crystalEnd1 = layout.checksums[0].ranges[0].end;
+    crystalChecksum1Location = layout.checksums[0].location;
+    crystalStart2 = layout.checksums[1].ranges[0].start;
+    crystalEnd2 = layout.checksums[1].ranges[0].end;
+    crystalChecksum2Location = layout.checksums[1].location;
+    
+    if (crystalEnd1 >= fileSize || crystalEnd2 >= fileSize) {
+        err() << "Error: Address out of range (file size: 0x" 
+                  << std::hex << fileSize << ")" << std::endl;
+        return false;
+    }
+    
+    out() << "\n=== Pokemon Crystal Checksum Calculation";
+    if (isJapanese) out() << " (Japanese)";
+    out() << " ===" << std::endl;
+    out() << "File: " << fileName << " (" << std::dec << fileSize << " bytes)" << std::endl;
+    
+    // First checksum
+    out() << "\n--- Checksum 1 ---" << std::endl;
+    out() << "Range: 0x" << HexUtils::toHexString(crystalStart1, 4) 
+              << " - 0x" << HexUtils::toHexString(crystalEnd1, 4) << std::endl;
+    out() << "Checksum location: 0x" << HexUtils::toHexString(crystalChecksum1Location, 4) << std::endl;
+    
+    crystalChecksum1 = calculateGBC16BitChecksum(crystalStart1, crystalEnd1, crystalTotalSum1);
+    crystalStoredChecksum1 = readU16LE(crystalChecksum1Location);
+    crystalChecksum1Matches = (crystalChecksum1 == crystalStoredChecksum1);
+    
+    out() << "Sum of range: 0x" << std::hex << crystalTotalSum1 << std::endl;
+    out() << "*** CHECKSUM 1: calc=0x" << HexUtils::toHexString(crystalChecksum1, 4)
+              << " stored=0x" << HexUtils::toHexString(crystalStoredChecksum1, 4)
+              << " (bytes: 0x" << formatReversedBytes16(crystalChecksum1) << ")"
+              << (crystalChecksum1Matches ? " OK" : " MISMATCH") << " ***" << std::endl;
+    
+    // Second checksum
+    out() << "\n--- Checksum 2 ---" << std::endl;
+    out() << "Range: 0x" << HexUtils::toHexString(crystalStart2, 4) 
+              << " - 0x" << HexUtils::toHexString(crystalEnd2, 4) << std::endl;
+    out() << "Checksum location: 0x" << HexUtils::toHexString(crystalChecksum2Location, 4) << std::endl;
+    
+    crystalChecksum2 = calculateGBC16BitChecksum(crystalStart2, crystalEnd2, crystalTotalSum2);
+    crystalStoredChecksum2 = readU16LE(crystalChecksum2Location);
+    crystalChecksum2Matches = (crystalChecksum2 == crystalStoredChecksum2);
+    
+    out() << "Sum of range: 0x" << std::hex << crystalTotalSum2 << std::endl;
+    out() << "*** CHECKSUM 2: calc=0x" << HexUtils::toHexString(crystalChecksum2, 4)
+              << " stored=0x" << HexUtils::toHexString(crystalStoredChecksum2, 4)
+              << " (bytes: 0x" << formatReversedBytes16(crystalChecksum2) << ")"
+              << (crystalChecksum2Matches ? " OK" : " MISMATCH") << " ***" << std::endl;
+    out() << "=============================================\n" << std::endl;
+    
+    return true;
+}
+
+bool ChecksumCore::calculateChecksumPokemonGeneration3() {
+    // Check file size (need at least 128KB for full save structure)
+    const size_t requiredSize = 0x20000;
+    
+    if (fileSize < requiredSize) {
+        err() << "Error: File too small (size: 0x" << std::hex << fileSize 
+                  << ", need at least 0x" << requiredSize << ")" << std::endl;
+        return false;
+    }
+
+    // No Japanese check as Gen 3 checksums are same as English (as far as I know)
+    
+    out() << "\n=== " << gameName << " Checksum Calculation ===" << std::endl;
+    out() << "File: " << fileName << " (" << std::dec << fileSize << " bytes)" << std::endl;
+    
+    // Calculate checksums for Save A (base 0x000000)
+    calculateGen3SaveBlock(0x000000, gen3SaveA, "Save A");
+    
+    // Calculate checksums for Save B (base 0x00E000)
+    calculateGen3SaveBlock(0x00E000, gen3SaveB, "Save B");
+    
+    // Determine which save is current
+    gen3SaveAIsCurrent = (gen3SaveA.saveIndex > gen3SaveB.saveIndex);
+    
+    out() << "\n--- Summary ---" << std::endl;
+    out() << "Save A index: " << std::dec << gen3SaveA.saveIndex << std::endl;
+    out() << "Save B index: " << std::dec << gen3SaveB.saveIndex << std::endl;
+    out() << "Current save: " << (gen3SaveAIsCurrent ? "A" : "B") << std::endl;
+    
+    // Count mismatches
+    int mismatchesA = 0, mismatchesB = 0;
+    for (int i = 0; i < 14; i++) {
+        if (!gen3SaveA.sections[i].matches) mismatchesA++;
+        if (!gen3SaveB.sections[i].matches) mismatchesB++;
+    }
+    
+    if (mismatchesA > 0) {
+        out() << "Save A: " << mismatchesA << " checksum mismatch(es)" << std::endl;
+    } else {
+        out() << "Save A: All checksums valid" << std::endl;
+    }
+    
+    if (mismatchesB > 0) {
+        out() << "Save B: " << mismatchesB << " checksum mismatch(es)" << std::endl;
+    } else {
+        out() << "Save B: All checksums valid" << std::endl;
+    }
+    
+    out() << "=============================================\n" << std::endl;
+    
+    return true;
+}
+
+// ============================================================================
+// Helper Calculation Functions
+// ============================================================================
+
+uint32_t ChecksumCore::sumRange(size_t start, size_t end) const {
+    // Inclusive range, clamped to the loaded file
+    if (start > end || start >= fileSize) return 0;
+    if (end >= fileSize) end = fileSize - 1;
+    
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(fileBuffer.data());
+    return ChecksumKernels::sumBytes(data + start, end - start + 1);
+}
+
+uint8_t ChecksumCore::calculateRedBlue8BitChecksum(size_t start, size_t end, uint32_t& outSum) {
+    outSum = sumRange(start, end);
+    uint8_t sumMod = outSum & 0xFF;
+    return ~sumMod;
+}
+
+uint16_t ChecksumCore::calculateGBC16BitChecksum(size_t start, size_t end, uint32_t& outSum) {
+    outSum = sumRange(start, end);
+    return outSum & 0xFFFF;
+}
+
+uint16_t ChecksumCore::calculateGBC16BitChecksumMultiRange(const std::vector<std::pair<size_t, size_t>>& ranges, uint32_t& outSum) {
+    outSum = 0;
+    for (const auto& range : ranges) {
+        outSum += sumRange(range.first, range.second);
+    }
+    return outSum & 0xFFFF;
+}
+
+uint16_t ChecksumCore::calculateGen3SectionChecksum(size_t baseAddr, size_t dataSize) {
+    return Generation3Utils::calculateSectionChecksum(fileBuffer, baseAddr, dataSize);
+}
+
+void ChecksumCore::calculateRedBlueBankChecksums(const GameLayouts::BoxBanks& banks, size_t baseAddr,
+                                                 RedBlueBankData& bankData) {
+    const size_t mainStart = banks.whole.ranges[0].start;
+    const size_t mainEnd = banks.whole.ranges[0].end;
+    const size_t mainChecksumOffset = banks.whole.location;
+    bankData.mainStart = baseAddr + mainStart;
+    bankData.mainEnd = baseAddr + mainEnd;
+    bankData.subCount = banks.boxCount;
+    
+    // Check if entire bank is filled with 0xFF (unused box)
+    bool isAllFF = true;
+    for (size_t i = baseAddr + mainStart; i <= baseAddr + mainEnd; i++) {
+        if (readU8(i) != 0xFF) {
+            isAllFF = false;
+            break;
+        }
+    }
+    
+    bankData.mainChecksum = calculateRedBlue8BitChecksum(
+        baseAddr + mainStart, 
+        baseAddr + mainEnd, 
+        bankData.mainSum
+    );
+    bankData.mainChecksumLocation = baseAddr + mainChecksumOffset;
+    bankData.mainStoredChecksum = readU8(bankData.mainChecksumLocation);
+    
+    if (isAllFF) {
+        bankData.mainMatches = true;
+        out() << "  [Bank filled with 0xFF - unused, treating as valid]" << std::endl;
+    } else {
+        bankData.mainMatches = (bankData.mainChecksum == bankData.mainStoredChecksum);
+    }
+    
+    out() << "  Main range: 0x" << HexUtils::toHexString(baseAddr + mainStart, 4) 
+              << " - 0x" << HexUtils::toHexString(baseAddr + mainEnd, 4) << std::endl;
+    out() << "  Main sum: 0x" << std::hex << bankData.mainSum 
+              << ", Checksum: calc=0x" << HexUtils::toHexString(bankData.mainChecksum, 2)
+              << " stored=0x" << HexUtils::toHexString(bankData.mainStoredChecksum, 2)
+              << " @ 0x" << HexUtils::toHexString(bankData.mainChecksumLocation, 4)
+              << (bankData.mainMatches ? " OK" : " MISMATCH") << std::endl;
+    
+    out() << "  Sub-checksums:" << std::endl;
+    for (size_t i = 0; i < banks.boxCount; i++) {
+        const GameLayouts::ByteRange& range = banks.boxes[i].ranges[0];
+        bankData.subChecksums[i] = calculateRedBlue8BitChecksum(
+            baseAddr + range.start,
+            baseAddr + range.end,
+            bankData.subSums[i]
+        );
+        bankData.subChecksumLocations[i] = baseAddr + banks.boxes[i].location;
+        bankData.subStoredChecksums[i] = readU8(bankData.subChecksumLocations[i]);
+        
+        if (isAllFF) {
+            bankData.subMatches[i] = true;
+        } else {
+            bankData.subMatches[i] = (bankData.subChecksums[i] == bankData.subStoredChecksums[i]);
+        }
+        
+        out() << "    [" << i << "] 0x" << HexUtils::toHexString(baseAddr + range.start, 4)
+                  << " - 0x" << HexUtils::toHexString(baseAddr + range.end, 4)
+                  << " : sum=0x" << std::hex << bankData.subSums[i]
+                  << ", calc=0x" << HexUtils::toHexString(bankData.subChecksums[i], 2)
+                  << " stored=0x" << HexUtils::toHexString(bankData.subStoredChecksums[i], 2)
+                  << " @ 0x" << HexUtils::toHexString(bankData.subChecksumLocations[i], 4)
+                  << (bankData.subMatches[i] ? " OK" : " MISMATCH") << std::endl;
+    }
+}
+
+void ChecksumCore::calculateGen3SaveBlock(size_t blockBaseAddr, Generation3Utils::SaveBlock& saveBlock, const char* blockName) {
+    out() << "\n--- " << blockName << " (base 0x" << HexUtils::toHexString(blockBaseAddr, 5) << ") ---" << std::endl;
+    
+    saveBlock.valid = true;
+    
+    for (int i = 0; i < 14; i++) {
+        size_t sectionBase = blockBaseAddr + (i * 0x1000);
+        
+        uint16_t sectionId = readU16LE(sectionBase + 0x0FF4);
+        uint16_t storedChecksum = readU16LE(sectionBase + 0x0FF6);
+        uint32_t saveIndex = readU32LE(sectionBase + 0x0FFC);
+        
+        if (sectionId > 13) {
+            err() << "Warning: Invalid section ID " << sectionId << " at section " << i << std::endl;
+            saveBlock.valid = false;
+            continue;
+        }
+        
+        size_t dataSize = Generation3Utils::GEN3_SECTION_SIZES[sectionId];
+        uint16_t calculatedChecksum = Generation3Utils::calculateSectionChecksum(fileBuffer, sectionBase, dataSize);
+        
+        // Populate the common structure
+        saveBlock.sections[i].sectionId = sectionId;
+        saveBlock.sections[i].saveIndex = saveIndex;
+        saveBlock.sections[i].dataSize = dataSize;
+        saveBlock.sections[i].sectionBaseAddress = sectionBase;
+        saveBlock.sections[i].calculatedChecksum = calculatedChecksum;
+        saveBlock.sections[i].storedChecksum = storedChecksum;
+        saveBlock.sections[i].checksumLocation = sectionBase + 0x0FF6;
+        saveBlock.sections[i].matches = (calculatedChecksum == storedChecksum);
+        
+        out() << "  Section " << std::dec << std::setw(2) << i 
+                  << " [ID " << std::setw(2) << sectionId << "]: "
+                  << "calc=0x" << HexUtils::toHexString(calculatedChecksum, 4)
+                  << " stored=0x" << HexUtils::toHexString(storedChecksum, 4)
+                  << " @ 0x" << HexUtils::toHexString(sectionBase + 0x0FF6, 5)
+                  << (saveBlock.sections[i].matches ? " OK" : " MISMATCH")
+                  << std::endl;
+    }
+    
+    saveBlock.saveIndex = saveBlock.sections[13].saveIndex;
+    out() << "  Save Index: " << std::dec << saveBlock.saveIndex << std::endl;
+}
+
+size_t ChecksumCore::findSectionOffset(const Generation3Utils::SaveBlock& saveBlock, uint16_t sectionId) {
+    return Generation3Utils::findSectionOffset(saveBlock.sections, sectionId);
+}
+
+void ChecksumCore::calculatePartyPokemonChecksums(const Generation3Utils::SaveBlock& saveBlock,
+                                                       std::vector<PokemonChecksumResult>& results,
+                                                       const std::string& saveBlockName) {
+    size_t sectionOffset = findSectionOffset(saveBlock, 1);
+    if (sectionOffset == static_cast<size_t>(-1)) {
+        err() << "Warning: Could not find Section 1 in " << saveBlockName << std::endl;
+        return;
+    }
+    
+    size_t teamSizeOffset;
+    size_t teamPokemonOffset;
+    
+    if (gameName == "Pokemon FireRed" || gameName == "Pokemon LeafGreen") {
+        teamSizeOffset = 0x0034;
+        teamPokemonOffset = 0x0038;
+    } else {
+        teamSizeOffset = 0x0234;
+        teamPokemonOffset = 0x0238;
+    }
+    
+    uint32_t teamSize = readU32LE(sectionOffset + teamSizeOffset);
+    
+    if (teamSize > 6) {
+        err() << "Warning: Invalid team size " << teamSize << " in " << saveBlockName << std::endl;
+        teamSize = 0;
+    }
+    
+    // Whole party in one batched kernel call
+    uint32_t offsets[6];
+    uint16_t checksums[6];
+    for (uint32_t i = 0; i < teamSize; i++) {
+        offsets[i] = static_cast<uint32_t>(sectionOffset + teamPokemonOffset + (i * 100));
+    }
+    ChecksumKernels::pokemonDataChecksums(reinterpret_cast<const uint8_t*>(fileBuffer.data()),
+                                          offsets, teamSize, checksums);
+    
+    for (uint32_t i = 0; i < teamSize; i++) {
+        PokemonChecksumResult result;
+        result.location = offsets[i] + 0x1C;
+        result.locationStr = saveBlockName + " Party " + std::to_string(i + 1);
+        result.calculated = checksums[i];
+        result.stored = Generation3Utils::getStoredPokemonChecksum(fileBuffer, offsets[i]);
+        result.valid = (result.calculated == result.stored);
+        results.push_back(result);
+    }
+}
+
+void ChecksumCore::calculateBoxPokemonChecksums(const Generation3Utils::SaveBlock& saveBlock,
+                                                     std::vector<PokemonChecksumResult>& results,
+                                                     const std::string& saveBlockName) {
+    using namespace Generation3Utils;
+    
+    // Gather sections 5-13 once, then checksum every slot in batches of eight
+    if (!pcBuffer.build(fileBuffer, saveBlock.sections)) {
+        return;
+    }
+    
+    static const std::vector<uint32_t> slotOffsets = [] {
+        std::vector<uint32_t> offsets(GEN3_TOTAL_BOX_SLOTS);
+        for (size_t slot = 0; slot < GEN3_TOTAL_BOX_SLOTS; slot++) {
+            offsets[slot] = static_cast<uint32_t>(slot * GEN3_BOX_POKEMON_SIZE);
+        }
+        return offsets;
+    }();
+    
+    uint16_t checksums[GEN3_TOTAL_BOX_SLOTS];
+    ChecksumKernels::pokemonDataChecksums(pcBuffer.data(), slotOffsets.data(),
+                                          GEN3_TOTAL_BOX_SLOTS, checksums);
+    
+    for (size_t slot = 0; slot < GEN3_TOTAL_BOX_SLOTS; slot++) {
+        const uint8_t* pokemon = pcBuffer.boxPokemon(slot);
+        
+        // Empty slots have a zero personality value
+        if (pokemon[0] == 0 && pokemon[1] == 0 && pokemon[2] == 0 && pokemon[3] == 0) {
+            continue;
+        }
+        
+        uint16_t calculatedChecksum = checksums[slot];
+        uint16_t storedChecksum = static_cast<uint16_t>(pokemon[0x1C]) |
+                                  (static_cast<uint16_t>(pokemon[0x1D]) << 8);
+        
+        int boxNumber = static_cast<int>(slot / GEN3_SLOTS_PER_BOX);
+        int slotInBox = static_cast<int>(slot % GEN3_SLOTS_PER_BOX);
+        
+        PokemonChecksumResult result;
+        result.location = pcBuffer.physicalAddress(pcBuffer.boxPokemonOffset(slot) + 0x1C);
+        result.calculated = calculatedChecksum;
+        result.stored = storedChecksum;
+        result.valid = (calculatedChecksum == storedChecksum);
+        result.locationStr = saveBlockName + " Box " + std::to_string(boxNumber + 1) + 
+                           " Slot " + std::to_string(slotInBox + 1);
+        
+        results.push_back(result);
+    }
+}
+
+void ChecksumCore::calculateAllPokemonChecksums(const Generation3Utils::SaveBlock& saveBlock,
+                                                     std::vector<PokemonChecksumResult>& results,
+                                                     const std::string& saveBlockName) {
+    results.clear();
+    results.reserve(6 + Generation3Utils::GEN3_TOTAL_BOX_SLOTS);
+    calculatePartyPokemonChecksums(saveBlock, results, saveBlockName);
+    calculateBoxPokemonChecksums(saveBlock, results, saveBlockName);
+}
+
+bool ChecksumCore::calculatePokemonChecksum() {
+    if (gameMode != GAME_POKEMON_GENERATION3) {
+        err() << "Error: -p flag is only for Generation 3 games" << std::endl;
+        err() << "Current game: " << gameName << std::endl;
+        return false;
+    }
+    
+    if (!calculateChecksumPokemonGeneration3()) {
+        return false;
+    }
+    
+    out() << "\n=== Pokemon Checksum Verification ===" << std::endl;
+    out() << "Checking all Pokemon in party and boxes..." << std::endl;
+    
+    calculateAllPokemonChecksums(gen3SaveA, pokemonResultsSaveA, "Save A");
+    calculateAllPokemonChecksums(gen3SaveB, pokemonResultsSaveB, "Save B");
+    
+    int invalidCountA = 0, invalidCountB = 0;
+    for (const auto& result : pokemonResultsSaveA) {
+        if (!result.valid) invalidCountA++;
+    }
+    for (const auto& result : pokemonResultsSaveB) {
+        if (!result.valid) invalidCountB++;
+    }
+    
+    out() << "\nSave A: Found " << pokemonResultsSaveA.size() << " Pokemon, " 
+              << invalidCountA << " invalid checksums" << std::endl;
+    out() << "Save B: Found " << pokemonResultsSaveB.size() << " Pokemon, " 
+              << invalidCountB << " invalid checksums" << std::endl;
+    
+    if (invalidCountA > 0) {
+        out() << "\nInvalid checksums in Save A:" << std::endl;
+        for (const auto& result : pokemonResultsSaveA) {
+            if (!result.valid) {
+                out() << "  " << result.locationStr << " @ 0x" 
+                          << HexUtils::toHexString(result.location, 5)
+                          << " - calc: 0x" << HexUtils::toHexString(result.calculated, 4)
+                          << " stored: 0x" << HexUtils::toHexString(result.stored, 4)
+                          << std::endl;
+            }
+        }
+    }
+    
+    if (invalidCountB > 0) {
+        out() << "\nInvalid checksums in Save B:" << std::endl;
+        for (const auto& result : pokemonResultsSaveB) {
+            if (!result.valid) {
+                out() << "  " << result.locationStr << " @ 0x" 
+                          << HexUtils::toHexString(result.location, 5)
+                          << " - calc: 0x" << HexUtils::toHexString(result.calculated, 4)
+                          << " stored: 0x" << HexUtils::toHexString(result.stored, 4)
+                          << std::endl;
+            }
+        }
+    }
+    
+    if (invalidCountA == 0 && invalidCountB == 0) {
+        out() << "\nAll Pokemon checksums are valid!" << std::endl;
+    }
+    
+    return true;
+}
+
+void ChecksumCore::repairPokemonChecksums() {
+    using namespace Generation3Utils;
+    
+    // Which 4KB sections of the file had a Pokemon checksum rewritten
+    bool touchedSections[GEN3_SAVE_SIZE / GEN3_SECTION_SIZE] = {};
+    
+    auto repairResults = [&](const std::vector<PokemonChecksumResult>& results) {
+        for (const auto& result : results) {
+            if (result.valid) continue;
+            // A box Pokemon's checksum word never straddles a section boundary,
+            // so both bytes live at location and location + 1
+            patchU16LE(result.location, result.calculated);
+            touchedSections[result.location / GEN3_SECTION_SIZE] = true;
+            pokemonRepairCount++;
+        }
+    };
+    
+    pokemonRepairCount = 0;
+    repairResults(pokemonResultsSaveA);
+    repairResults(pokemonResultsSaveB);
+    
+    // Only the sections that changed need their checksums recalculated
+    size_t sectionsUpdated = 0;
+    for (SaveBlock* saveBlock : {&gen3SaveA, &gen3SaveB}) {
+        for (size_t i = 0; i < GEN3_NUM_SECTIONS; i++) {
+            SectionInfo& section = saveBlock->sections[i];
+            if (section.dataSize == 0 || !touchedSections[section.sectionBaseAddress / GEN3_SECTION_SIZE]) {
+                continue;
+            }
+            section.calculatedChecksum = calculateSectionChecksum(fileBuffer, section.sectionBaseAddress, section.dataSize);
+            section.matches = (section.calculatedChecksum == section.storedChecksum);
+            sectionsUpdated++;
+        }
+    }
+    
+    out() << "\nRepaired " << std::dec << pokemonRepairCount << " Pokemon checksum(s), "
+          << "recalculated " << sectionsUpdated << " section checksum(s)" << std::endl;
+}
+
+// ============================================================================
+// File Writing
+// ============================================================================
+
+std::string ChecksumCore::editedOutputPath(const std::string& fileName) {
+    std::string baseName = HexUtils::getBaseName(fileName);
+    size_t dotPos = baseName.rfind('.');
+    std::string nameWithoutExt = baseName.substr(0, dotPos);
+    std::string extension = (dotPos != std::string::npos) ? baseName.substr(dotPos) : "";
+    return "edited_files/" + nameWithoutExt + "_checksum" + extension;
+}
+
+bool ChecksumCore::writeChecksumsToFile() {
+    std::string outputFile;
+    
+    if (shouldOverwrite) {
+        if (!confirmOverwrite(HexUtils::getBaseName(fileName))) {
+            out() << "\nOverwrite cancelled. Exiting program." << std::endl;
+            return false;
+        }
+        
+        outputFile = fileName;
+    } else {
+        mkdir("edited_files", 0755);
+        outputFile = editedOutputPath(fileName);
+    }
+    
+    switch (gameMode) {
+        case GAME_POKEMON_RED_BLUE:
+            patchU8(redBlueBank1ChecksumLocation, redBlueBank1Checksum);
+            
+            patchU8(redBlueBank2.mainChecksumLocation, redBlueBank2.mainChecksum);
+            for (size_t i = 0; i < redBlueBank2.subCount; i++) {
+                patchU8(redBlueBank2.subChecksumLocations[i], redBlueBank2.subChecksums[i]);
+            }
+            
+            patchU8(redBlueBank3.mainChecksumLocation, redBlueBank3.mainChecksum);
+            for (size_t i = 0; i < redBlueBank3.subCount; i++) {
+                patchU8(redBlueBank3.subChecksumLocations[i], redBlueBank3.subChecksums[i]);
+            }
+            break;
+            
+        case GAME_POKEMON_GOLD_SILVER:
+            patchU16LE(goldSilverChecksum1Location, goldSilverChecksum1);
+            patchU16LE(goldSilverChecksum2Location, goldSilverChecksum2);
+            break;
+            
+        case GAME_POKEMON_CRYSTAL:
+            patchU16LE(crystalChecksum1Location, crystalChecksum1);
+            patchU16LE(crystalChecksum2Location, crystalChecksum2);
+            break;
+            
+        case GAME_POKEMON_GENERATION3:
+            for (int i = 0; i < 14; i++) {
+                patchU16LE(gen3SaveA.sections[i].checksumLocation, gen3SaveA.sections[i].calculatedChecksum);
+                patchU16LE(gen3SaveB.sections[i].checksumLocation, gen3SaveB.sections[i].calculatedChecksum);
+            }
+            break;
+    }
+    
+    // Only the changed checksum bytes hit the disk; edited_files/ copies are
+    // cloned from the original first
+    if (!PatchWriter::save(fileName, outputFile, fileBuffer, fileSize, filePatches)) {
+        err() << "Failed to create output file: " << outputFile << std::endl;
+        return false;
+    }
+    
+    if (shouldOverwrite) {
+        out() << "\nChecksums written (file overwritten): " << outputFile << std::endl;
+    } else {
+        out() << "\nChecksums written to: " << outputFile << std::endl;
+    }
+    
+    return true;
+}
+
+// ============================================================================
+// Formatting Helpers
+// ============================================================================
+
+std::string ChecksumCore::formatReversedBytes16(uint16_t value) {
+    uint8_t low = value & 0xFF;
+    uint8_t high = (value >> 8) & 0xFF;
+    std::stringstream ss;
+    ss << HexUtils::toHexString(low, 2) << HexUtils::toHexString(high, 2);
+    return ss.str();
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+std::ostream& ChecksumCore::out() {
+    return verbose ? *reportStream : nullStream;
+}
+
+std::ostream& ChecksumCore::err() {
+    return *errorStream;
+}
+
+bool ChecksumCore::confirmOverwrite(const std::string& /*displayName*/) {
+    // No display to ask on; callers opt in to overwriting with -w -o
+    return true;
+}
+
+int ChecksumCore::countMismatches() const {
+    int mismatches = 0;
+    
+    if (pokemonChecksumMode) {
+        for (const auto& result : pokemonResultsSaveA) {
+            if (!result.valid) mismatches++;
+        }
+        for (const auto& result : pokemonResultsSaveB) {
+            if (!result.valid) mismatches++;
+        }
+        return mismatches;
+    }
+    
+    switch (gameMode) {
+        case GAME_POKEMON_RED_BLUE:
+            if (!redBlueBank1Matches) mismatches++;
+            if (!redBlueBank2.mainMatches) mismatches++;
+            if (!redBlueBank3.mainMatches) mismatches++;
+            for (size_t i = 0; i < redBlueBank2.subCount; i++) {
+                if (!redBlueBank2.subMatches[i]) mismatches++;
+            }
+            for (size_t i = 0; i < redBlueBank3.subCount; i++) {
+                if (!redBlueBank3.subMatches[i]) mismatches++;
+            }
+            break;
+        case GAME_POKEMON_GOLD_SILVER:
+            if (!goldSilverChecksum1Matches) mismatches++;
+            if (!goldSilverChecksum2Matches) mismatches++;
+            break;
+        case GAME_POKEMON_CRYSTAL:
+            if (!crystalChecksum1Matches) mismatches++;
+            if (!crystalChecksum2Matches) mismatches++;
+            break;
+        case GAME_POKEMON_GENERATION3:
+            for (int i = 0; i < 14; i++) {
+                if (!gen3SaveA.sections[i].matches) mismatches++;
+                if (!gen3SaveB.sections[i].matches) mismatches++;
+            }
+            break;
+    }
+    
+    return mismatches;
+}
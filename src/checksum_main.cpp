@@ -1,18 +1,36 @@
 #include "checksum/checksum_calc.h"
+#include "checksum/checksum_core.h"
 #include "common/hex_utils.h"
+#include "common/work_stealing_pool.h"
+#include "common/checksum_kernels.h"
 #include <iostream>
 #include <vector>
+#include <string>
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <cerrno>
+#include <thread>
 
 void printUsage(const char* progName) {
     std::cerr << "Checksum Calculator" << std::endl;
     std::cerr << "\nCalculates game-specific checksums with hardcoded addresses." << std::endl;
     std::cerr << "\nUsage:" << std::endl;
     std::cerr << "  " << progName << " [-j] [-w] [-o] [-p] <file> <game>" << std::endl;
+    std::cerr << "  " << progName << " --headless [-j] [-w] [-o] [-p] [-v] [-r] [--jobs N] <game> <file|directory>..." << std::endl;
     std::cerr << "\nOptions:" << std::endl;
     std::cerr << "  -j, --japan   Use Japanese version addresses (Gen 1 and 2 games)" << std::endl;
     std::cerr << "  -w            Write checksums to file (saves in edited_files/)" << std::endl;
     std::cerr << "  -o            Overwrite original file (requires -w)" << std::endl;
-    std::cerr << "  -p            Pokemon checksum mode (doesn't work with -w)" << std::endl;
+    std::cerr << "  -p            Pokemon checksum mode (with -w: repair invalid Pokemon checksums)" << std::endl;
+    std::cerr << "  --headless    Verify many files without opening a window (one line per file)" << std::endl;
+    std::cerr << "  -v            Print the full report for every file (headless mode)" << std::endl;
+    std::cerr << "  -r            Recurse into subdirectories (headless mode)" << std::endl;
+    std::cerr << "  --jobs N      Worker threads for headless mode (default: all cores)" << std::endl;
     std::cerr << "\nSupported games:" << std::endl;
     std::cerr << "  red, blue, yellow, green - Pokemon Red/Blue/Yellow and Japanese Green (GB)" << std::endl;
     std::cerr << "  gold, silver             - Pokemon Gold/Silver (GBC)" << std::endl;
@@ -20,6 +38,7 @@ void printUsage(const char* progName) {
     std::cerr << "  ruby, sapphire, emerald, firered, leafgreen - Pokemon Generation 3 (GBA)" << std::endl;
     std::cerr << "                  14 sections per save block (A and B)" << std::endl;
     std::cerr << "                  Each section has independent checksum" << std::endl;
+    std::cerr << "  auto                     - Detect the game (and -j) from the save itself" << std::endl;
     std::cerr << "\nExamples:" << std::endl;
     std::cerr << "  " << progName << " Pokemon_Red.sav red" << std::endl;
     std::cerr << "  " << progName << " -w Pokemon_Gold.sav gold" << std::endl;
@@ -28,7 +47,221 @@ void printUsage(const char* progName) {
     std::cerr << "  " << progName << " -j -w Pokemon_Gold_JP.sav gold" << std::endl;
     std::cerr << "  " << progName << " -w Pokemon_Emerald.sav emerald" << std::endl;
     std::cerr << "  " << progName << " -p Pokemon_Emerald.sav emerald" << std::endl;
+    std::cerr << "  " << progName << " -p -w Pokemon_Emerald.sav emerald" << std::endl;
     std::cerr << "  " << progName << " Pokemon_FireRed.sav firered" << std::endl;
+    std::cerr << "  " << progName << " --headless emerald saves/" << std::endl;
+    std::cerr << "  " << progName << " --headless auto saves/" << std::endl;
+    std::cerr << "  " << progName << " --headless -r --jobs 8 firered archive/" << std::endl;
+    std::cerr << "  " << progName << " --headless -j crystal a.sav b.sav" << std::endl;
+}
+
+// ============================================================================
+// Headless Batch Mode
+// ============================================================================
+
+struct HeadlessOptions {
+    bool isJapanese = false;
+    bool shouldWrite = false;
+    bool shouldOverwrite = false;
+    bool pokemonMode = false;
+    bool verbose = false;
+    bool recursive = false;
+    size_t jobs = 0;  // 0 = one worker per hardware thread
+};
+
+enum class FileStatus { OK, MISMATCH, REPAIRED, ERROR };
+
+struct FileResult {
+    FileStatus status = FileStatus::ERROR;
+    int mismatches = 0;
+    std::string report;  // full per-file report, only filled with -v
+    std::string errors;  // warnings and errors raised while checking this file
+};
+
+// Expands directories into their regular files (recursively with -r), sorted by path
+static bool collectInputFiles(const std::vector<std::string>& paths, bool recursive,
+                              std::vector<std::string>& files) {
+    namespace fs = std::filesystem;
+    
+    for (const auto& path : paths) {
+        std::error_code ec;
+        if (!fs::is_directory(path, ec)) {
+            files.push_back(path);
+            continue;
+        }
+        
+        std::vector<std::string> dirFiles;
+        if (recursive) {
+            fs::recursive_directory_iterator it(path, fs::directory_options::skip_permission_denied, ec);
+            for (; !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+                if (it->is_regular_file(ec)) {
+                    dirFiles.push_back(it->path().string());
+                }
+            }
+        } else {
+            fs::directory_iterator it(path, ec);
+            for (; !ec && it != fs::directory_iterator(); it.increment(ec)) {
+                if (it->is_regular_file(ec)) {
+                    dirFiles.push_back(it->path().string());
+                }
+            }
+        }
+        if (ec) {
+            std::cerr << "Failed to read directory: " << path << " (" << ec.message() << ")" << std::endl;
+            return false;
+        }
+        std::sort(dirFiles.begin(), dirFiles.end());
+        files.insert(files.end(), dirFiles.begin(), dirFiles.end());
+    }
+    
+    return true;
+}
+
+static FileResult verifyFile(const std::string& file, const std::string& game,
+                             const HeadlessOptions& options) {
+    FileResult result;
+    std::ostringstream report;
+    std::ostringstream errors;
+    
+    // Fresh core per file so no results leak between saves
+    ChecksumCore core;
+    core.setVerbose(options.verbose);
+    core.setReportStream(report);
+    core.setErrorStream(errors);
+    core.setJapanese(options.isJapanese);
+    core.setWriteMode(options.shouldWrite);
+    core.setOverwriteMode(options.shouldOverwrite);
+    core.setPokemonMode(options.pokemonMode);
+    
+    if (core.loadFile(file.c_str()) && core.setGame(game) && core.calculateChecksum()) {
+        result.mismatches = core.countMismatches();
+        if (result.mismatches == 0) {
+            result.status = FileStatus::OK;
+        } else {
+            // With -w the mismatches found have just been written back fixed
+            result.status = options.shouldWrite ? FileStatus::REPAIRED : FileStatus::MISMATCH;
+        }
+    }
+    result.report = report.str();
+    result.errors = errors.str();
+    return result;
+}
+
+// With -w, inputs that would be written to the same file (same basename in
+// different directories, or one file listed twice) can't be repaired in
+// parallel without one overwriting the other. They are marked as errors up
+// front instead of being checked.
+static std::vector<bool> findOutputConflicts(const std::vector<std::string>& files,
+                                             const HeadlessOptions& options,
+                                             std::vector<FileResult>& results) {
+    namespace fs = std::filesystem;
+    std::vector<bool> conflicting(files.size(), false);
+    if (!options.shouldWrite) return conflicting;
+    
+    std::map<std::string, std::vector<size_t>> byOutput;
+    for (size_t i = 0; i < files.size(); i++) {
+        std::string output = options.shouldOverwrite ? files[i]
+                                                     : ChecksumCore::editedOutputPath(files[i]);
+        std::error_code ec;
+        fs::path normalized = fs::weakly_canonical(output, ec);
+        byOutput[ec ? output : normalized.string()].push_back(i);
+    }
+    
+    for (const auto& entry : byOutput) {
+        if (entry.second.size() < 2) continue;
+        for (size_t i : entry.second) {
+            conflicting[i] = true;
+            std::ostringstream message;
+            message << "Error: " << files[i] << " shares its output file " << entry.first
+                    << " with " << (entry.second.size() - 1) << " other input(s); "
+                    << "repair them in separate runs" << std::endl;
+            results[i].errors = message.str();
+        }
+    }
+    return conflicting;
+}
+
+static int runHeadless(const std::string& game, const std::vector<std::string>& paths,
+                       const HeadlessOptions& options) {
+    std::vector<std::string> files;
+    if (!collectInputFiles(paths, options.recursive, files)) {
+        return 1;
+    }
+    
+    auto startTime = std::chrono::steady_clock::now();
+    
+    // Each task owns one slot, so results need no locking and print in input order
+    std::vector<FileResult> results(files.size());
+    std::vector<bool> conflicting = findOutputConflicts(files, options, results);
+    size_t workerCount = 1;
+    {
+        WorkStealingPool pool(options.jobs);
+        workerCount = pool.size();
+        for (size_t i = 0; i < files.size(); i++) {
+            if (conflicting[i]) continue;
+            pool.submit([&, i] { results[i] = verifyFile(files[i], game, options); });
+        }
+        pool.wait();
+    }
+    
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    
+    size_t okCount = 0, mismatchCount = 0, repairedCount = 0, errorCount = 0;
+    for (size_t i = 0; i < files.size(); i++) {
+        const FileResult& result = results[i];
+        std::cout << result.report;
+        std::cerr << result.errors;
+        
+        switch (result.status) {
+            case FileStatus::OK:
+                std::cout << "OK       " << files[i] << std::endl;
+                okCount++;
+                break;
+            case FileStatus::MISMATCH:
+                std::cout << "MISMATCH " << files[i] << " (" << result.mismatches
+                          << (options.pokemonMode ? " invalid Pokemon)" : " checksum(s))") << std::endl;
+                mismatchCount++;
+                break;
+            case FileStatus::REPAIRED:
+                std::cout << "REPAIRED " << files[i] << " (" << result.mismatches
+                          << (options.pokemonMode ? " Pokemon)" : " checksum(s))") << std::endl;
+                repairedCount++;
+                break;
+            case FileStatus::ERROR:
+                std::cout << "ERROR    " << files[i] << std::endl;
+                errorCount++;
+                break;
+        }
+    }
+    
+    std::cout << "\n" << files.size() << " file(s): " << okCount << " OK, "
+              << mismatchCount << " mismatched, " << repairedCount << " repaired, "
+              << errorCount << " error(s)"
+              << " [" << workerCount << " thread(s), " << ChecksumKernels::activeKernelName()
+              << " kernels, " << std::fixed << std::setprecision(2)
+              << seconds << "s]" << std::endl;
+    
+    return (mismatchCount == 0 && errorCount == 0) ? 0 : 1;
+}
+
+// A whole number from 1 up to a few threads per core; anything else is an
+// error rather than a silent "all cores" or an attempt to start millions of
+// threads
+static bool parseJobCount(const char* text, size_t& jobs) {
+    unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    size_t maxJobs = static_cast<size_t>(hardwareThreads) * 4;
+    
+    errno = 0;
+    char* end = nullptr;
+    unsigned long value = std::strtoul(text, &end, 10);
+    bool isNumber = text[0] >= '0' && text[0] <= '9' && end != text && *end == '\0' && errno == 0;
+    if (!isNumber || value == 0 || value > maxJobs) {
+        std::cerr << "Error: --jobs expects a whole number from 1 to " << maxJobs
+                  << ", got '" << text << "'" << std::endl;
+        return false;
+    }
+    jobs = static_cast<size_t>(value);
+    return true;
 }
 
 int main(int argc, char** argv) {
@@ -41,6 +274,8 @@ int main(int argc, char** argv) {
     bool shouldWrite = false;
     bool shouldOverwrite = false;
     bool pokemonMode = false; 
+    bool headless = false;
+    HeadlessOptions headlessOptions;
     int argIndex = 1;
     
     // Parse flags
@@ -54,6 +289,20 @@ int main(int argc, char** argv) {
             shouldOverwrite = true;
         } else if (flag == "-p") {
             pokemonMode = true;
+        } else if (flag == "--headless") {
+            headless = true;
+        } else if (flag == "-v") {
+            headlessOptions.verbose = true;
+        } else if (flag == "-r") {
+            headlessOptions.recursive = true;
+        } else if (flag == "--jobs") {
+            if (argIndex + 1 >= argc) {
+                std::cerr << "Error: --jobs requires a thread count" << std::endl;
+                return 1;
+            }
+            if (!parseJobCount(argv[++argIndex], headlessOptions.jobs)) {
+                return 1;
+            }
         } else {
             std::cerr << "Unknown flag: " << flag << std::endl;
             printUsage(argv[0]);
@@ -70,6 +319,22 @@ int main(int argc, char** argv) {
     }
     
     // Check remaining arguments
+    if (headless) {
+        if (argc - argIndex < 2) {
+            std::cerr << "Error: Missing game and/or file argument" << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        
+        headlessOptions.isJapanese = isJapanese;
+        headlessOptions.shouldWrite = shouldWrite;
+        headlessOptions.shouldOverwrite = shouldOverwrite;
+        headlessOptions.pokemonMode = pokemonMode;
+        
+        std::vector<std::string> paths(argv + argIndex + 1, argv + argc);
+        return runHeadless(argv[argIndex], paths, headlessOptions);
+    }
+    
     if (argc - argIndex < 2) {
         std::cerr << "Error: Missing file and/or game argument" << std::endl;
         printUsage(argv[0]);
@@ -102,6 +367,11 @@ int main(int argc, char** argv) {
         return 1;
     }
     
+    // Writing is a one-shot operation; only show the window for plain verification
+    if (shouldWrite) {
+        return 0;
+    }
+    
     calc.run();
     
     return 0;
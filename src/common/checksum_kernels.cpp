@@ -0,0 +1,240 @@
+#include "checksum_kernels.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CHECKSUM_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// ============================================================================
+// Scalar Kernels (portable fallback, also used for vector tails)
+// ============================================================================
+
+uint32_t loadU32LE(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) |
+           (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint32_t sumBytesScalar(const uint8_t* data, size_t length) {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+uint32_t sumWordsScalar(const uint8_t* data, size_t wordCount) {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < wordCount; i++) {
+        sum += loadU32LE(data + i * 4);
+    }
+    return sum;
+}
+
+void pokemonDataChecksumsScalar(const uint8_t* base, const uint32_t* offsets, size_t count, uint16_t* out) {
+    for (size_t m = 0; m < count; m++) {
+        const uint8_t* pokemon = base + offsets[m];
+        uint32_t key = loadU32LE(pokemon) ^ loadU32LE(pokemon + 4);
+        uint32_t sum = 0;
+        for (int i = 0; i < 12; i++) {
+            uint32_t word = loadU32LE(pokemon + 0x20 + i * 4) ^ key;
+            sum += (word & 0xFFFF) + (word >> 16);
+        }
+        out[m] = static_cast<uint16_t>(sum);
+    }
+}
+
+#ifdef CHECKSUM_KERNELS_X86
+
+// ============================================================================
+// SSE2 Kernels
+// ============================================================================
+
+// psadbw against zero sums each group of 8 bytes into a 64-bit lane
+__attribute__((target("sse2")))
+uint32_t sumBytesSSE2(const uint8_t* data, size_t length) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(bytes, zero));
+    }
+
+    uint32_t sum = static_cast<uint32_t>(_mm_cvtsi128_si32(acc)) +
+                   static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_unpackhi_epi64(acc, acc)));
+    return sum + sumBytesScalar(data + i, length - i);
+}
+
+// x86 is little-endian, so plain 32-bit lane adds match readU32LE sums
+__attribute__((target("sse2")))
+uint32_t sumWordsSSE2(const uint8_t* data, size_t wordCount) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 4 <= wordCount; i += 4) {
+        acc = _mm_add_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 4)));
+    }
+
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    uint32_t sum = static_cast<uint32_t>(_mm_cvtsi128_si32(acc));
+    return sum + sumWordsScalar(data + i * 4, wordCount - i);
+}
+
+// ============================================================================
+// AVX2 Kernels
+// ============================================================================
+
+__attribute__((target("avx2")))
+uint32_t sumBytesAVX2(const uint8_t* data, size_t length) {
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+
+    // Two independent accumulators hide the psadbw/add latency chain
+    for (; i + 64 <= length; i += 64) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32));
+        acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(a, zero));
+        acc1 = _mm256_add_epi64(acc1, _mm256_sad_epu8(b, zero));
+    }
+    for (; i + 32 <= length; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(a, zero));
+    }
+
+    __m256i acc = _mm256_add_epi64(acc0, acc1);
+    __m128i half = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    half = _mm_add_epi64(half, _mm_unpackhi_epi64(half, half));
+    uint32_t sum = static_cast<uint32_t>(_mm_cvtsi128_si32(half));
+    return sum + sumBytesScalar(data + i, length - i);
+}
+
+__attribute__((target("avx2")))
+uint32_t sumWordsAVX2(const uint8_t* data, size_t wordCount) {
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 16 <= wordCount; i += 16) {
+        acc0 = _mm256_add_epi32(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 4)));
+        acc1 = _mm256_add_epi32(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 4 + 32)));
+    }
+    for (; i + 8 <= wordCount; i += 8) {
+        acc0 = _mm256_add_epi32(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 4)));
+    }
+
+    __m256i acc = _mm256_add_epi32(acc0, acc1);
+    __m128i half = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+    uint32_t sum = static_cast<uint32_t>(_mm_cvtsi128_si32(half));
+    return sum + sumWordsScalar(data + i * 4, wordCount - i);
+}
+
+// Eight Pokemon per iteration, one per 32-bit lane: gather PID/OTID to build
+// the per-lane key, then gather, decrypt and accumulate each of the 12 words.
+// A final partial batch masks off the unused lanes so nothing is read past them.
+__attribute__((target("avx2")))
+void pokemonDataChecksumsAVX2(const uint8_t* base, const uint32_t* offsets, size_t count, uint16_t* out) {
+    const int* words = reinterpret_cast<const int*>(base);
+    const __m256i lowMask = _mm256_set1_epi32(0xFFFF);
+    const __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    for (size_t m = 0; m < count; m += 8) {
+        size_t lanes = (count - m < 8) ? (count - m) : 8;
+        __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(lanes)), laneIndex);
+
+        __m256i index;
+        if (lanes == 8) {
+            index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets + m));
+        } else {
+            alignas(32) uint32_t partial[8] = {};
+            for (size_t i = 0; i < lanes; i++) partial[i] = offsets[m + i];
+            index = _mm256_load_si256(reinterpret_cast<const __m256i*>(partial));
+        }
+
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i pid = _mm256_mask_i32gather_epi32(zero, words, index, mask, 1);
+        __m256i otid = _mm256_mask_i32gather_epi32(zero, words + 1, index, mask, 1);
+        __m256i key = _mm256_xor_si256(pid, otid);
+        __m256i sum = _mm256_setzero_si256();
+
+        for (int i = 0; i < 12; i++) {
+            __m256i word = _mm256_mask_i32gather_epi32(zero, words + 8 + i, index, mask, 1);
+            word = _mm256_xor_si256(word, key);
+            sum = _mm256_add_epi32(sum, _mm256_and_si256(word, lowMask));
+            sum = _mm256_add_epi32(sum, _mm256_srli_epi32(word, 16));
+        }
+
+        // Keep the low 16 bits of each lane and pack them down to eight uint16_t
+        sum = _mm256_and_si256(sum, lowMask);
+        __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        if (lanes == 8) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + m), packed);
+        } else {
+            alignas(16) uint16_t partial[8];
+            _mm_store_si128(reinterpret_cast<__m128i*>(partial), packed);
+            for (size_t i = 0; i < lanes; i++) out[m + i] = partial[i];
+        }
+    }
+}
+
+#endif // CHECKSUM_KERNELS_X86
+
+// ============================================================================
+// Runtime Dispatch
+// ============================================================================
+
+struct KernelSet {
+    const char* name;
+    uint32_t (*sumBytes)(const uint8_t*, size_t);
+    uint32_t (*sumWords)(const uint8_t*, size_t);
+    void (*pokemonChecksums)(const uint8_t*, const uint32_t*, size_t, uint16_t*);
+};
+
+KernelSet selectKernels() {
+#ifdef CHECKSUM_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {"avx2", sumBytesAVX2, sumWordsAVX2, pokemonDataChecksumsAVX2};
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return {"sse2", sumBytesSSE2, sumWordsSSE2, pokemonDataChecksumsScalar};
+    }
+#endif
+    return {"scalar", sumBytesScalar, sumWordsScalar, pokemonDataChecksumsScalar};
+}
+
+// Resolved once; function-local statics are initialized thread-safely
+const KernelSet& kernels() {
+    static const KernelSet selected = selectKernels();
+    return selected;
+}
+
+} // namespace
+
+namespace ChecksumKernels {
+    
+    uint32_t sumBytes(const uint8_t* data, size_t length) {
+        return kernels().sumBytes(data, length);
+    }
+    
+    uint32_t sumWordsLE(const uint8_t* data, size_t wordCount) {
+        return kernels().sumWords(data, wordCount);
+    }
+    
+    void pokemonDataChecksums(const uint8_t* base, const uint32_t* offsets, size_t count, uint16_t* out) {
+        kernels().pokemonChecksums(base, offsets, count, out);
+    }
+    
+    const char* activeKernelName() {
+        return kernels().name;
+    }
+}
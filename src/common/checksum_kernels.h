@@ -0,0 +1,26 @@
+#ifndef CHECKSUM_KERNELS_H
+#define CHECKSUM_KERNELS_H
+
+#include <cstdint>
+#include <cstddef>
+
+// Vectorized summing kernels behind the save checksums. The widest kernel the
+// CPU supports (AVX2, SSE2, or portable scalar) is picked once on first use.
+namespace ChecksumKernels {
+    
+    // Sum of `length` unsigned bytes, modulo 2^32 (Gen 1 8-bit / Gen 2 16-bit checksums)
+    uint32_t sumBytes(const uint8_t* data, size_t length);
+    
+    // Sum of `wordCount` little-endian 32-bit words, modulo 2^32 (Gen 3 section checksums)
+    uint32_t sumWordsLE(const uint8_t* data, size_t wordCount);
+    
+    // Gen 3 Pokemon data checksums for the structures at base + offsets[i]: each
+    // one decrypts the 48 bytes at +0x20 with PID ^ OTID and sums the 16-bit
+    // halves into out[i]. The AVX2 kernel handles eight Pokemon per iteration.
+    void pokemonDataChecksums(const uint8_t* base, const uint32_t* offsets, size_t count, uint16_t* out);
+    
+    // Name of the kernel set selected for this CPU ("avx2", "sse2" or "scalar")
+    const char* activeKernelName();
+}
+
+#endif // CHECKSUM_KERNELS_H
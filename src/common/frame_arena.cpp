@@ -0,0 +1,75 @@
+#include "frame_arena.h"
+#include <algorithm>
+#include <cstring>
+
+// ============================================================================
+// Constructor
+// ============================================================================
+
+FrameArena::FrameArena(size_t capacity)
+    : block(new char[capacity]), capacity(capacity) {
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+char* FrameArena::allocate(size_t size) {
+    if (used + size <= capacity) {
+        char* result = block.get() + used;
+        used += size;
+        return result;
+    }
+
+    if (overflow.empty() || overflowUsed + size > overflowCapacity) {
+        overflowCapacity = std::max(size, capacity);
+        overflow.emplace_back(new char[overflowCapacity]);
+        overflowUsed = 0;
+    }
+    char* result = overflow.back().get() + overflowUsed;
+    overflowUsed += size;
+    overflowTotal += size;
+    return result;
+}
+
+std::string_view FrameArena::copy(std::string_view text) {
+    char* out = allocate(text.size());
+    if (!text.empty()) {
+        std::memcpy(out, text.data(), text.size());
+    }
+    return std::string_view(out, text.size());
+}
+
+std::string_view FrameArena::concat(std::initializer_list<std::string_view> parts) {
+    size_t length = 0;
+    for (std::string_view part : parts) {
+        length += part.size();
+    }
+
+    char* out = allocate(length);
+    size_t pos = 0;
+    for (std::string_view part : parts) {
+        if (!part.empty()) {
+            std::memcpy(out + pos, part.data(), part.size());
+            pos += part.size();
+        }
+    }
+    return std::string_view(out, length);
+}
+
+void FrameArena::reset() {
+    // Size the block for the frame that just overflowed it
+    if (!overflow.empty()) {
+        size_t needed = used + overflowTotal;
+        while (capacity < needed) {
+            capacity = (capacity > 0) ? capacity * 2 : needed;
+        }
+        block.reset(new char[capacity]);
+        overflow.clear();
+    }
+
+    used = 0;
+    overflowCapacity = 0;
+    overflowUsed = 0;
+    overflowTotal = 0;
+}
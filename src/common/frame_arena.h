@@ -0,0 +1,50 @@
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// ============================================================================
+// Frame Arena
+// ============================================================================
+// Bump allocator for text that only has to live until the end of a frame.
+// Allocations are never freed individually; reset() releases them all at
+// once. A frame that outgrows the block spills into overflow blocks, and
+// the next reset() replaces the block with one large enough for that frame,
+// so a steady-state frame allocates nothing from the heap. Memory is handed
+// out unaligned and is meant for characters only.
+
+class FrameArena {
+public:
+    explicit FrameArena(size_t capacity = DEFAULT_CAPACITY);
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    char* allocate(size_t size);
+
+    std::string_view copy(std::string_view text);
+    std::string_view concat(std::initializer_list<std::string_view> parts);
+
+    // Invalidates everything handed out since the last reset
+    void reset();
+
+    size_t bytesUsed() const { return used + overflowTotal; }
+
+private:
+    static constexpr size_t DEFAULT_CAPACITY = 16 * 1024;
+
+    std::unique_ptr<char[]> block;
+    size_t capacity;
+    size_t used = 0;
+
+    std::vector<std::unique_ptr<char[]>> overflow;
+    size_t overflowCapacity = 0;    // of overflow.back()
+    size_t overflowUsed = 0;        // of overflow.back()
+    size_t overflowTotal = 0;       // across all overflow blocks
+};
+
+#endif // FRAME_ARENA_H
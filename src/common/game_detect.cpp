@@ -0,0 +1,153 @@
+#include "game_detect.h"
+#include "data_utils.h"
+#include "game_layouts.h"
+#include "generation3_utils.h"
+#include <vector>
+
+namespace {
+
+// ============================================================================
+// Game Boy
+// ============================================================================
+
+GameDetect::Family familyOf(GameLayouts::Layout layout) {
+    switch (layout) {
+        case GameLayouts::Layout::GEN1_ENG:
+        case GameLayouts::Layout::GEN1_JPN:
+            return GameDetect::FAMILY_GEN1;
+        case GameLayouts::Layout::GOLD_SILVER_ENG:
+        case GameLayouts::Layout::GOLD_SILVER_JPN:
+            return GameDetect::FAMILY_GOLD_SILVER;
+        case GameLayouts::Layout::CRYSTAL_ENG:
+        case GameLayouts::Layout::CRYSTAL_JPN:
+            return GameDetect::FAMILY_CRYSTAL;
+        default:
+            return GameDetect::FAMILY_GEN3;
+    }
+}
+
+// Every Game Boy range and checksum lies in the first 32KB of SRAM
+constexpr size_t GB_SCAN_SIZE = 0x8000;
+
+// Scores each layout against one table of byte prefix sums, so the buffer
+// is read once no matter how many candidates there are
+void detectGameBoy(std::string_view buffer, GameDetect::Result& best) {
+    size_t scanSize = (buffer.size() < GB_SCAN_SIZE) ? buffer.size() : GB_SCAN_SIZE;
+    std::vector<uint32_t> prefix(scanSize + 1, 0);
+    for (size_t i = 0; i < scanSize; i++) {
+        prefix[i + 1] = prefix[i] + static_cast<uint8_t>(buffer[i]);
+    }
+
+    for (GameLayouts::Layout candidate : GameLayouts::GB_LAYOUTS) {
+        const GameLayouts::GameLayout& layout = GameLayouts::get(candidate);
+        bool eightBit = (layout.checksumKind == GameLayouts::ChecksumKind::INVERTED_8BIT);
+        int evidence = 0;
+        for (size_t c = 0; c < layout.checksumCount; c++) {
+            const GameLayouts::Checksum& check = layout.checksums[c];
+            if (check.location + (eightBit ? 1u : 2u) > scanSize) continue;
+
+            uint32_t sum = 0;
+            bool inRange = true;
+            for (size_t r = 0; r < check.rangeCount; r++) {
+                const GameLayouts::ByteRange& range = check.ranges[r];
+                if (range.end >= scanSize) {
+                    inRange = false;
+                    break;
+                }
+                sum += prefix[range.end + 1] - prefix[range.start];
+            }
+            // An all-zero range "matches" a zero checksum in any blank file
+            if (!inRange || sum == 0) continue;
+
+            if (eightBit) {
+                uint8_t expected = static_cast<uint8_t>(~(sum & 0xFF));
+                if (DataUtils::readU8(buffer, check.location) == expected) evidence += 8;
+            } else {
+                uint16_t expected = static_cast<uint16_t>(sum & 0xFFFF);
+                if (DataUtils::readU16LE(buffer, check.location) == expected) evidence += 16;
+            }
+        }
+
+        if (evidence > best.evidence) {
+            best.family = familyOf(candidate);
+            best.japanese = layout.japanese;
+            best.gen3Game = -1;
+            best.game = layout.game;
+            best.description = layout.description;
+            best.evidence = evidence;
+        }
+    }
+}
+
+// ============================================================================
+// Generation 3
+// ============================================================================
+
+void detectGeneration3(std::string_view buffer, GameDetect::Result& best) {
+    using namespace Generation3Utils;
+    if (buffer.size() < 2 * GEN3_BLOCK_SIZE) return;
+
+    int evidence = 0;
+    uint32_t bestSaveIndex = 0;
+    size_t section0Offset = static_cast<size_t>(-1);
+
+    for (size_t block = 0; block < 2; block++) {
+        size_t blockBase = block * GEN3_BLOCK_SIZE;
+        size_t blockSection0 = static_cast<size_t>(-1);
+        uint32_t blockSaveIndex = 0;
+        int validSections = 0;
+
+        for (size_t i = 0; i < GEN3_NUM_SECTIONS; i++) {
+            size_t sectionBase = blockBase + i * GEN3_SECTION_SIZE;
+            uint16_t sectionId = DataUtils::readU16LE(buffer, sectionBase + GEN3_SECTION_ID_OFFSET);
+            if (sectionId >= GEN3_NUM_SECTIONS) continue;
+            if (DataUtils::readU32LE(buffer, sectionBase + GEN3_SECTION_SIGNATURE_OFFSET) != GEN3_SECTION_SIGNATURE) continue;
+
+            uint16_t stored = DataUtils::readU16LE(buffer, sectionBase + GEN3_SECTION_CHECKSUM_OFFSET);
+            if (calculateSectionChecksum(buffer, sectionBase, GEN3_SECTION_SIZES[sectionId]) != stored) continue;
+
+            validSections++;
+            blockSaveIndex = DataUtils::readU32LE(buffer, sectionBase + GEN3_SECTION_SAVE_INDEX_OFFSET);
+            if (sectionId == 0) blockSection0 = sectionBase;
+        }
+
+        evidence += validSections * 16;
+        // The game code is read from the most recent save that has a Section 0
+        if (validSections > 0 && blockSection0 != static_cast<size_t>(-1) &&
+            (section0Offset == static_cast<size_t>(-1) || blockSaveIndex > bestSaveIndex)) {
+            section0Offset = blockSection0;
+            bestSaveIndex = blockSaveIndex;
+        }
+    }
+
+    if (evidence <= best.evidence || section0Offset == static_cast<size_t>(-1)) return;
+
+    best.family = GameDetect::FAMILY_GEN3;
+    best.japanese = false;
+    best.evidence = evidence;
+
+    uint32_t gameCode = DataUtils::readU32LE(buffer, section0Offset + GEN3_GAME_CODE_OFFSET);
+    GameLayouts::Layout layout = GameLayouts::Layout::EMERALD;
+    best.gen3Game = GEN3_GAME_EMERALD;
+    if (gameCode == 0) {
+        layout = GameLayouts::Layout::RUBY_SAPPHIRE;
+        best.gen3Game = GEN3_GAME_RS;
+    } else if (gameCode == 1) {
+        layout = GameLayouts::Layout::FIRERED_LEAFGREEN;
+        best.gen3Game = GEN3_GAME_FRLG;
+    }
+    best.game = GameLayouts::get(layout).game;
+    best.description = GameLayouts::get(layout).description;
+}
+
+} // namespace
+
+namespace GameDetect {
+
+    Result detect(std::string_view buffer) {
+        Result best;
+        detectGameBoy(buffer, best);
+        detectGeneration3(buffer, best);
+        return best;
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef GAME_DETECT_H
+#define GAME_DETECT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+// ============================================================================
+// Save File Game Detection
+// ============================================================================
+// Fingerprints a save buffer without being told the game. Game Boy saves are
+// scored by how many of each candidate layout's checksums (English and
+// Japanese) hold; Gen 3 saves by their section footers and section checksums,
+// with the game code in Section 0 telling Ruby/Sapphire, FireRed/LeafGreen
+// and Emerald apart. Games that share a layout (Red/Blue/Yellow, Gold/Silver,
+// Ruby/Sapphire, FireRed/LeafGreen) are reported as their first member.
+
+namespace GameDetect {
+
+    enum Family {
+        FAMILY_UNKNOWN,
+        FAMILY_GEN1,
+        FAMILY_GOLD_SILVER,
+        FAMILY_CRYSTAL,
+        FAMILY_GEN3
+    };
+
+    struct Result {
+        Family family = FAMILY_UNKNOWN;
+        bool japanese = false;
+        int gen3Game = -1;                  // Generation3Utils::Gen3Game for FAMILY_GEN3
+        const char* game = nullptr;         // name every tool's setGame() accepts
+        const char* description = "Unknown";
+        int evidence = 0;                   // checksum bits that matched
+
+        bool found() const { return family != FAMILY_UNKNOWN; }
+    };
+
+    // Name that makes the tools' setGame() detect the game from the loaded file
+    constexpr const char* AUTO_GAME = "auto";
+
+    Result detect(std::string_view buffer);
+}
+
+#endif // GAME_DETECT_H
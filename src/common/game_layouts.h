@@ -0,0 +1,423 @@
+#ifndef GAME_LAYOUTS_H
+#define GAME_LAYOUTS_H
+
+#include "checksum_kernels.h"
+#include "data_utils.h"
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+// ============================================================================
+// Per-Game Save Layouts
+// ============================================================================
+// Checksum ranges, party offset and bag pockets of every game and region whose
+// save layout differs, as constexpr data shared by checksum, pokemon_bag,
+// pokemon_party and the game detector. Each layout is a specialization of
+// LayoutTraits, so get<L>() is a compile-time constant and the layouts are
+// checked by static_assert below. Tools parse the game name once in setGame()
+// and from then on only carry a Layout value.
+
+namespace GameLayouts {
+
+    enum class Layout {
+        GEN1_ENG,
+        GEN1_JPN,
+        GOLD_SILVER_ENG,
+        GOLD_SILVER_JPN,
+        CRYSTAL_ENG,
+        CRYSTAL_JPN,
+        RUBY_SAPPHIRE,
+        EMERALD,
+        FIRERED_LEAFGREEN
+    };
+
+    enum class Game {
+        GEN1,
+        GOLD_SILVER,
+        CRYSTAL,
+        RUBY_SAPPHIRE,
+        EMERALD,
+        FIRERED_LEAFGREEN
+    };
+
+    enum class ChecksumKind {
+        NONE,               // Gen 3: per-section checksums, see Generation3Utils
+        INVERTED_8BIT,      // Gen 1: ~(sum of bytes) & 0xFF
+        SUM_16BIT_LE        // Gen 2: sum of bytes & 0xFFFF, stored little-endian
+    };
+
+    // Bytes the stored checksum occupies
+    constexpr size_t checksumWidth(ChecksumKind kind) {
+        return (kind == ChecksumKind::INVERTED_8BIT) ? 1 : 2;
+    }
+
+    struct ByteRange {
+        uint32_t start;
+        uint32_t end;       // inclusive
+    };
+
+    struct Checksum {
+        ByteRange ranges[3];
+        size_t rangeCount;
+        uint32_t location;
+    };
+
+    // Gen 1 PC box banks (SRAM banks 2 and 3): one checksum over the whole
+    // bank plus one per box. Ranges and locations are relative to the bank's
+    // base address.
+    constexpr size_t MAX_BANK_BOXES = 6;
+
+    struct BoxBanks {
+        uint32_t bases[2];
+        size_t bankCount;
+        Checksum whole;
+        Checksum boxes[MAX_BANK_BOXES];
+        size_t boxCount;
+    };
+
+    struct Pocket {
+        const char* name;
+        size_t capacity;
+        bool hasQuantity;
+        bool idStored;
+        bool idEditable;
+        bool quantityEditable;
+        bool nameEditable;
+        size_t primaryOffset;       // Gen 3: relative to Section 1
+        size_t secondaryOffset;     // Gen 2 backup copy, 0 if none
+    };
+
+    struct GameLayout {
+        const char* game;           // name setGame() accepts
+        const char* description;
+        int generation;
+        bool japanese;
+        ChecksumKind checksumKind;
+        Checksum checksums[2];
+        size_t checksumCount;
+        size_t partyOffset;         // 0 where the party editor has no layout
+        Pocket pockets[5];
+        size_t pocketCount;
+        BoxBanks boxBanks;          // Gen 1 only, bankCount 0 elsewhere
+    };
+
+    // Pocket shapes used across the games
+    constexpr Pocket itemPocket(const char* name, size_t capacity, size_t primary, size_t secondary = 0) {
+        return {name, capacity, true, true, true, true, true, primary, secondary};
+    }
+
+    constexpr Pocket keyItemPocket(size_t capacity, size_t primary, size_t secondary) {
+        return {"Key Items", capacity, false, true, true, false, true, primary, secondary};
+    }
+
+    // Gen 2 TM/HM pocket: one quantity byte per TM, the ID is the position
+    constexpr Pocket tmQuantityPocket(size_t primary, size_t secondary) {
+        return {"TMs/HMs", 57, true, false, false, true, false, primary, secondary};
+    }
+
+    constexpr Checksum singleRange(uint32_t start, uint32_t end, uint32_t location) {
+        return {{{start, end}, {0, 0}, {0, 0}}, 1, location};
+    }
+
+    constexpr BoxBanks NO_BOX_BANKS = {};
+
+    constexpr BoxBanks GEN1_BOX_BANKS = {
+        {0x4000, 0x6000}, 2,
+        singleRange(0x0000, 0x1A4B, 0x1A4C),
+        {singleRange(0x0000, 0x0461, 0x1A4D),
+         singleRange(0x0462, 0x08C3, 0x1A4E),
+         singleRange(0x08C4, 0x0D25, 0x1A4F),
+         singleRange(0x0D26, 0x1187, 0x1A50),
+         singleRange(0x1188, 0x15E9, 0x1A51),
+         singleRange(0x15EA, 0x1A4B, 0x1A52)}, 6
+    };
+
+    // ========================================================================
+    // Layouts
+    // ========================================================================
+
+    template <Layout L> struct LayoutTraits;
+
+    template <> struct LayoutTraits<Layout::GEN1_ENG> {
+        static constexpr GameLayout value = {
+            "red", "Pokemon Red/Blue/Yellow", 1, false, ChecksumKind::INVERTED_8BIT,
+            {singleRange(0x2598, 0x3522, 0x3523)}, 1,
+            0x2F2C,
+            {itemPocket("Items", 20, 0x25C9)}, 1,
+            GEN1_BOX_BANKS
+        };
+    };
+
+    template <> struct LayoutTraits<Layout::GEN1_JPN> {
+        static constexpr GameLayout value = {
+            "red", "Pokemon Red/Green/Blue/Yellow", 1, true, ChecksumKind::INVERTED_8BIT,
+            {singleRange(0x2598, 0x3593, 0x3594)}, 1,
+            0x2ED5,
+            {itemPocket("Items", 20, 0x25C4)}, 1,
+            GEN1_BOX_BANKS
+        };
+    };
+
+    template <> struct LayoutTraits<Layout::GOLD_SILVER_ENG> {
+        static constexpr GameLayout value = {
+            "gold", "Pokemon Gold/Silver", 2, false, ChecksumKind::SUM_16BIT_LE,
+            {singleRange(0x2009, 0x2D68, 0x2D69),
+             {{{0x0C6B, 0x17EC}, {0x3D96, 0x3F3F}, {0x7E39, 0x7E6C}}, 3, 0x7E6D}}, 2,
+            0x288A,
+            {tmQuantityPocket(0x23E6, 0x0C78),
+             itemPocket("Items", 20, 0x241F, 0x0CB1),
+             keyItemPocket(26, 0x2449, 0x0CDB),
+             itemPocket("Balls", 12, 0x2464, 0x0CF6)}, 4,
+            NO_BOX_BANKS
+        };
+    };
+
+    template <> struct LayoutTraits<Layout::GOLD_SILVER_JPN> {
+        static constexpr GameLayout value = {
+            "gold", "Pokemon Gold/Silver", 2, true, ChecksumKind::SUM_16BIT_LE,
+            {singleRange(0x2009, 0x2C8B, 0x2D0D),
+             singleRange(0x7209, 0x7E8B, 0x7F0D)}, 2,
+            0x283E,
+            {tmQuantityPocket(0x23C7, 0x75C7),
+             itemPocket("Items", 20, 0x2400, 0x7600),
+             keyItemPocket(26, 0x242A, 0x762A),
+             itemPocket("Balls", 12, 0x2445, 0x7645)}, 4,
+            NO_BOX_BANKS
+        };
+    };
+
+    template <> struct LayoutTraits<Layout::CRYSTAL_ENG> {
+        static constexpr GameLayout value = {
+            "crystal", "Pokemon Crystal", 2, false, ChecksumKind::SUM_16BIT_LE,
+            {singleRange(0x2009, 0x2B82, 0x2D0D),
+             singleRange(0x1209, 0x1D82, 0x1F0D)}, 2,
+            0x2865,
+            {tmQuantityPocket(0x23E7, 0x15E7),
+             itemPocket("Items", 20, 0x2420, 0x1620),
+             keyItemPocket(26, 0x244A, 0x164A),
+             itemPocket("Balls", 12, 0x2465, 0x1665)}, 4,
+            NO_BOX_BANKS
+        };
+    };
+
+    template <> struct LayoutTraits<Layout::CRYSTAL_JPN> {
+        static constexpr GameLayout value = {
+            "crystal", "Pokemon Crystal", 2, true, ChecksumKind::SUM_16BIT_LE,
+            {singleRange(0x2009, 0x2AE2, 0x2D0D),
+             singleRange(0x7209, 0x7CE2, 0x7F0D)}, 2,
+            0x281A,
+            {tmQuantityPocket(0x23C9, 0x75C9),
+             itemPocket("Items", 20, 0x2402, 0x7602),
+             keyItemPocket(26, 0x242C, 0x762C),
+             itemPocket("Balls", 12, 0x2447, 0x7647)}, 4,
+            NO_BOX_BANKS
+        };
+    };
+
+    template <> struct LayoutTraits<Layout::RUBY_SAPPHIRE> {
+        static constexpr GameLayout value = {
+            "ruby", "Pokemon Ruby/Sapphire", 3, false, ChecksumKind::NONE,
+            {}, 0,
+            0,
+            {itemPocket("Items", 20, 0x0560),
+             itemPocket("Key Items", 20, 0x05B0),
+             itemPocket("Poke Balls", 16, 0x0600),
+             itemPocket("TMs/HMs", 64, 0x0640),
+             itemPocket("Berries", 46, 0x0740)}, 5,
+            NO_BOX_BANKS
+        };
+    };
+
+    template <> struct LayoutTraits<Layout::EMERALD> {
+        static constexpr GameLayout value = {
+            "emerald", "Pokemon Emerald", 3, false, ChecksumKind::NONE,
+            {}, 0,
+            0,
+            {itemPocket("Items", 30, 0x0560),
+             itemPocket("Key Items", 30, 0x05D8),
+             itemPocket("Poke Balls", 16, 0x0650),
+             itemPocket("TMs/HMs", 64, 0x0690),
+             itemPocket("Berries", 46, 0x0790)}, 5,
+            NO_BOX_BANKS
+        };
+    };
+
+    template <> struct LayoutTraits<Layout::FIRERED_LEAFGREEN> {
+        static constexpr GameLayout value = {
+            "firered", "Pokemon FireRed/LeafGreen", 3, false, ChecksumKind::NONE,
+            {}, 0,
+            0,
+            {itemPocket("Items", 42, 0x0310),
+             itemPocket("Key Items", 30, 0x03B8),
+             itemPocket("Poke Balls", 13, 0x0430),
+             itemPocket("TMs/HMs", 58, 0x0464),
+             itemPocket("Berries", 43, 0x054C)}, 5,
+            NO_BOX_BANKS
+        };
+    };
+
+    template <Layout L>
+    constexpr const GameLayout& get() {
+        return LayoutTraits<L>::value;
+    }
+
+    // Every Game Boy layout, in the order the detector scores them
+    constexpr Layout GB_LAYOUTS[] = {
+        Layout::GEN1_ENG, Layout::GEN1_JPN,
+        Layout::GOLD_SILVER_ENG, Layout::GOLD_SILVER_JPN,
+        Layout::CRYSTAL_ENG, Layout::CRYSTAL_JPN
+    };
+
+    constexpr const GameLayout& get(Layout layout) {
+        switch (layout) {
+            case Layout::GEN1_ENG:          return get<Layout::GEN1_ENG>();
+            case Layout::GEN1_JPN:          return get<Layout::GEN1_JPN>();
+            case Layout::GOLD_SILVER_ENG:   return get<Layout::GOLD_SILVER_ENG>();
+            case Layout::GOLD_SILVER_JPN:   return get<Layout::GOLD_SILVER_JPN>();
+            case Layout::CRYSTAL_ENG:       return get<Layout::CRYSTAL_ENG>();
+            case Layout::CRYSTAL_JPN:       return get<Layout::CRYSTAL_JPN>();
+            case Layout::RUBY_SAPPHIRE:     return get<Layout::RUBY_SAPPHIRE>();
+            case Layout::EMERALD:           return get<Layout::EMERALD>();
+            case Layout::FIRERED_LEAFGREEN: return get<Layout::FIRERED_LEAFGREEN>();
+        }
+        return get<Layout::GEN1_ENG>();
+    }
+
+    // Gen 3 saves have no regional layout differences the tools care about
+    constexpr Layout layoutOf(Game game, bool japanese) {
+        switch (game) {
+            case Game::GEN1:              return japanese ? Layout::GEN1_JPN : Layout::GEN1_ENG;
+            case Game::GOLD_SILVER:       return japanese ? Layout::GOLD_SILVER_JPN : Layout::GOLD_SILVER_ENG;
+            case Game::CRYSTAL:           return japanese ? Layout::CRYSTAL_JPN : Layout::CRYSTAL_ENG;
+            case Game::RUBY_SAPPHIRE:     return Layout::RUBY_SAPPHIRE;
+            case Game::EMERALD:           return Layout::EMERALD;
+            case Game::FIRERED_LEAFGREEN: return Layout::FIRERED_LEAFGREEN;
+        }
+        return Layout::GEN1_ENG;
+    }
+
+    // ========================================================================
+    // Compile-Time Checks
+    // ========================================================================
+
+    // A box bank checksum stays inside its 8KB bank and doesn't cover its own
+    // location
+    constexpr bool isConsistentBankChecksum(const Checksum& checksum) {
+        if (checksum.rangeCount != 1 || checksum.location >= 0x2000) return false;
+        const ByteRange& range = checksum.ranges[0];
+        return range.start <= range.end && range.end < 0x2000 &&
+               (checksum.location < range.start || checksum.location > range.end);
+    }
+
+    // Ranges are ordered, stay inside the 32KB Game Boy SRAM image and never
+    // cover the checksum they feed; pockets fit in 32KB (Gen 1/2) or a section
+    constexpr bool isConsistent(const GameLayout& layout) {
+        size_t width = checksumWidth(layout.checksumKind);
+        for (size_t c = 0; c < layout.checksumCount; c++) {
+            const Checksum& checksum = layout.checksums[c];
+            if (checksum.rangeCount == 0 || checksum.location + width > 0x8000) return false;
+            for (size_t r = 0; r < checksum.rangeCount; r++) {
+                const ByteRange& range = checksum.ranges[r];
+                if (range.start > range.end || range.end >= 0x8000) return false;
+                if (checksum.location + width > range.start && checksum.location <= range.end) return false;
+            }
+        }
+        size_t limit = (layout.generation == 3) ? 0xF80 : 0x8000;
+        for (size_t p = 0; p < layout.pocketCount; p++) {
+            const Pocket& pocket = layout.pockets[p];
+            if (pocket.capacity == 0 || pocket.primaryOffset >= limit || pocket.secondaryOffset >= limit) return false;
+        }
+        const BoxBanks& banks = layout.boxBanks;
+        if (banks.bankCount > 0) {
+            if (banks.boxCount == 0 || banks.boxCount > MAX_BANK_BOXES) return false;
+            if (!isConsistentBankChecksum(banks.whole)) return false;
+            for (size_t b = 0; b < banks.boxCount; b++) {
+                if (!isConsistentBankChecksum(banks.boxes[b])) return false;
+            }
+            for (size_t b = 0; b < banks.bankCount; b++) {
+                if (banks.bases[b] % 0x2000 != 0 || banks.bases[b] + 0x2000 > 0x8000) return false;
+            }
+        }
+        return layout.pocketCount > 0;
+    }
+
+    static_assert(isConsistent(get<Layout::GEN1_ENG>()), "Gen 1 (English) layout");
+    static_assert(isConsistent(get<Layout::GEN1_JPN>()), "Gen 1 (Japanese) layout");
+    static_assert(isConsistent(get<Layout::GOLD_SILVER_ENG>()), "Gold/Silver (English) layout");
+    static_assert(isConsistent(get<Layout::GOLD_SILVER_JPN>()), "Gold/Silver (Japanese) layout");
+    static_assert(isConsistent(get<Layout::CRYSTAL_ENG>()), "Crystal (English) layout");
+    static_assert(isConsistent(get<Layout::CRYSTAL_JPN>()), "Crystal (Japanese) layout");
+    static_assert(isConsistent(get<Layout::RUBY_SAPPHIRE>()), "Ruby/Sapphire layout");
+    static_assert(isConsistent(get<Layout::EMERALD>()), "Emerald layout");
+    static_assert(isConsistent(get<Layout::FIRERED_LEAFGREEN>()), "FireRed/LeafGreen layout");
+
+    // ========================================================================
+    // Checksums
+    // ========================================================================
+
+    inline bool fitsIn(ChecksumKind kind, const Checksum& checksum, size_t size) {
+        if (checksum.location + checksumWidth(kind) > size) return false;
+        for (size_t r = 0; r < checksum.rangeCount; r++) {
+            if (checksum.ranges[r].end >= size) return false;
+        }
+        return true;
+    }
+
+    inline uint32_t sumChecksumRanges(std::string_view buffer, const Checksum& checksum) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(buffer.data());
+        uint32_t sum = 0;
+        for (size_t r = 0; r < checksum.rangeCount; r++) {
+            const ByteRange& range = checksum.ranges[r];
+            sum += ChecksumKernels::sumBytes(data + range.start, range.end - range.start + 1);
+        }
+        return sum;
+    }
+
+    inline uint16_t checksumFromSum(ChecksumKind kind, uint32_t sum) {
+        if (kind == ChecksumKind::INVERTED_8BIT) {
+            return static_cast<uint8_t>(~(sum & 0xFF));
+        }
+        return static_cast<uint16_t>(sum & 0xFFFF);
+    }
+
+    inline uint16_t readStoredChecksum(std::string_view buffer, ChecksumKind kind, const Checksum& checksum) {
+        if (kind == ChecksumKind::INVERTED_8BIT) {
+            return DataUtils::readU8(buffer, checksum.location);
+        }
+        return DataUtils::readU16LE(buffer, checksum.location);
+    }
+
+    // Recalculates and stores every checksum of layout L. onWrite(offset,
+    // length) is called for each checksum written, e.g. to record a patch.
+    template <Layout L, typename Buffer, typename OnWrite>
+    void writeChecksums(Buffer& buffer, size_t size, OnWrite onWrite) {
+        constexpr const GameLayout& layout = get<L>();
+        for (size_t c = 0; c < layout.checksumCount; c++) {
+            const Checksum& checksum = layout.checksums[c];
+            if (!fitsIn(layout.checksumKind, checksum, size)) continue;
+
+            uint16_t value = checksumFromSum(layout.checksumKind, sumChecksumRanges(buffer, checksum));
+            if (layout.checksumKind == ChecksumKind::INVERTED_8BIT) {
+                DataUtils::writeU8(buffer, checksum.location, static_cast<uint8_t>(value));
+            } else {
+                DataUtils::writeU16LE(buffer, checksum.location, value);
+            }
+            onWrite(checksum.location, checksumWidth(layout.checksumKind));
+        }
+    }
+
+    template <typename Buffer, typename OnWrite>
+    void writeChecksums(Layout layout, Buffer& buffer, size_t size, OnWrite onWrite) {
+        switch (layout) {
+            case Layout::GEN1_ENG:        writeChecksums<Layout::GEN1_ENG>(buffer, size, onWrite); break;
+            case Layout::GEN1_JPN:        writeChecksums<Layout::GEN1_JPN>(buffer, size, onWrite); break;
+            case Layout::GOLD_SILVER_ENG: writeChecksums<Layout::GOLD_SILVER_ENG>(buffer, size, onWrite); break;
+            case Layout::GOLD_SILVER_JPN: writeChecksums<Layout::GOLD_SILVER_JPN>(buffer, size, onWrite); break;
+            case Layout::CRYSTAL_ENG:     writeChecksums<Layout::CRYSTAL_ENG>(buffer, size, onWrite); break;
+            case Layout::CRYSTAL_JPN:     writeChecksums<Layout::CRYSTAL_JPN>(buffer, size, onWrite); break;
+            default: break;     // Gen 3 section checksums are handled per section
+        }
+    }
+}
+
+#endif // GAME_LAYOUTS_H
@@ -1,25 +1,26 @@
 #include "generation3_utils.h"
 #include "data_utils.h"
+#include "checksum_kernels.h"
 
 namespace Generation3Utils {
     
-    uint32_t getPID(const std::string& buffer, size_t pokemonBaseAddr) {
+    uint32_t getPID(std::string_view buffer, size_t pokemonBaseAddr) {
         return DataUtils::readU32LE(buffer, pokemonBaseAddr + 0x00);
     }
     
-    uint32_t getOTID(const std::string& buffer, size_t pokemonBaseAddr) {
+    uint32_t getOTID(std::string_view buffer, size_t pokemonBaseAddr) {
         return DataUtils::readU32LE(buffer, pokemonBaseAddr + 0x04);
     }
     
-    uint32_t getDecryptionKey(const std::string& buffer, size_t pokemonBaseAddr) {
+    uint32_t getDecryptionKey(std::string_view buffer, size_t pokemonBaseAddr) {
         return getPID(buffer, pokemonBaseAddr) ^ getOTID(buffer, pokemonBaseAddr);
     }
     
-    uint16_t getStoredPokemonChecksum(const std::string& buffer, size_t pokemonBaseAddr) {
+    uint16_t getStoredPokemonChecksum(std::string_view buffer, size_t pokemonBaseAddr) {
         return DataUtils::readU16LE(buffer, pokemonBaseAddr + 0x1C);
     }
     
-    uint16_t calculatePokemonDataChecksum(const std::string& buffer, size_t pokemonBaseAddr, uint32_t decryptionKey) {
+    uint16_t calculatePokemonDataChecksum(std::string_view buffer, size_t pokemonBaseAddr, uint32_t decryptionKey) {
         uint32_t sum = 0;
         
         // Process 48 bytes (12 words) of encrypted data starting at offset 0x20
@@ -50,12 +51,9 @@ namespace Generation3Utils {
         return static_cast<size_t>(-1);
     }
     
-    uint16_t calculateSectionChecksum(const std::string& buffer, size_t baseAddr, size_t dataSize) {
-        uint32_t sum = 0;
-        
-        for (size_t i = 0; i < dataSize; i += 4) {
-            sum += DataUtils::readU32LE(buffer, baseAddr + i);
-        }
+    uint16_t calculateSectionChecksum(std::string_view buffer, size_t baseAddr, size_t dataSize) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(buffer.data()) + baseAddr;
+        uint32_t sum = ChecksumKernels::sumWordsLE(data, (dataSize + 3) / 4);
         
         // Fold to 16-bit: upper + lower
         uint16_t upper = (sum >> 16) & 0xFFFF;
@@ -64,7 +62,7 @@ namespace Generation3Utils {
         return upper + lower;
     }
     
-    uint32_t getSecurityKey(const std::string& buffer, int game, size_t section0Offset) {
+    uint32_t getSecurityKey(std::string_view buffer, int game, size_t section0Offset) {
         // Ruby/Sapphire: no encryption, return 0
         if (game == GEN3_GAME_RS) {
             return 0;
@@ -102,4 +100,44 @@ namespace Generation3Utils {
         // Emerald and FRLG: XOR with lower 16 bits of security key
         return quantity ^ static_cast<uint16_t>(securityKey & 0xFFFF);
     }
-}
\ No newline at end of file
+    
+    bool PCBuffer::build(std::string_view buffer, const SectionInfo* sections) {
+        image.clear();
+        image.reserve((GEN3_PC_LAST_SECTION - GEN3_PC_FIRST_SECTION + 1) * GEN3_PC_SECTION_DATA_SIZE);
+        chunkCount = 0;
+        size_t logicalPos = 0;
+        
+        for (uint16_t sectionId = GEN3_PC_FIRST_SECTION; sectionId <= GEN3_PC_LAST_SECTION; sectionId++) {
+            size_t sectionOffset = findSectionOffset(sections, sectionId);
+            if (sectionOffset == static_cast<size_t>(-1)) continue;
+            
+            size_t startOffset = (sectionId == GEN3_PC_FIRST_SECTION) ? GEN3_PC_HEADER_SIZE : 0;
+            size_t length = GEN3_PC_SECTION_DATA_SIZE - startOffset;
+            size_t physicalStart = sectionOffset + startOffset;
+            if (physicalStart + length > buffer.size()) continue;
+            
+            chunks[chunkCount++] = {logicalPos, physicalStart, length};
+            const uint8_t* src = reinterpret_cast<const uint8_t*>(buffer.data()) + physicalStart;
+            image.insert(image.end(), src, src + length);
+            logicalPos += length;
+        }
+        
+        // Zero-pad so every box slot is addressable; all-zero slots read as empty
+        size_t minimumSize = GEN3_TOTAL_BOX_SLOTS * GEN3_BOX_POKEMON_SIZE;
+        if (image.size() < minimumSize) {
+            image.resize(minimumSize, 0);
+        }
+        
+        return chunkCount > 0;
+    }
+    
+    size_t PCBuffer::physicalAddress(size_t logicalOffset) const {
+        for (size_t i = 0; i < chunkCount; i++) {
+            const Chunk& chunk = chunks[i];
+            if (logicalOffset < chunk.logicalStart + chunk.length) {
+                return chunk.physicalStart + (logicalOffset - chunk.logicalStart);
+            }
+        }
+        return 0;
+    }
+}
@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <cstddef>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace Generation3Utils {
     
@@ -16,12 +18,18 @@ namespace Generation3Utils {
     // Section structure offsets
     static constexpr size_t GEN3_SECTION_ID_OFFSET = 0xFF4;
     static constexpr size_t GEN3_SECTION_CHECKSUM_OFFSET = 0xFF6;
+    static constexpr size_t GEN3_SECTION_SIGNATURE_OFFSET = 0xFF8;
     static constexpr size_t GEN3_SECTION_SAVE_INDEX_OFFSET = 0xFFC;
+    static constexpr uint32_t GEN3_SECTION_SIGNATURE = 0x08012025;
     
     // Security key offsets within Section 0
     static constexpr size_t GEN3_SECURITY_KEY_OFFSET_E = 0x00AC;
     static constexpr size_t GEN3_SECURITY_KEY_OFFSET_FRLG = 0x0AF8;
     
+    // Section 0 game code: 0 on Ruby/Sapphire, 1 on FireRed/LeafGreen, and
+    // Emerald's security key (shares the offset) otherwise
+    static constexpr size_t GEN3_GAME_CODE_OFFSET = 0x00AC;
+    
     // Game type constants for Gen 3
     enum Gen3Game {
         GEN3_GAME_RS = 0,
@@ -67,24 +75,63 @@ namespace Generation3Utils {
         bool valid;
     };
     
+    // PC storage: sections 5-13 form one logical stream of boxed Pokemon
+    static constexpr uint16_t GEN3_PC_FIRST_SECTION = 5;
+    static constexpr uint16_t GEN3_PC_LAST_SECTION = 13;
+    static constexpr size_t GEN3_PC_SECTION_DATA_SIZE = 0x0F80;
+    static constexpr size_t GEN3_PC_HEADER_SIZE = 0x04;       // Current box, at the start of section 5
+    static constexpr size_t GEN3_BOX_POKEMON_SIZE = 80;
+    static constexpr size_t GEN3_NUM_BOXES = 14;
+    static constexpr size_t GEN3_SLOTS_PER_BOX = 30;
+    static constexpr size_t GEN3_TOTAL_BOX_SLOTS = GEN3_NUM_BOXES * GEN3_SLOTS_PER_BOX;
+    
+    // Contiguous copy of the PC storage with a map back to file offsets.
+    // Built once per save block; the image is reused so rebuilding does not allocate.
+    class PCBuffer {
+    public:
+        // Gathers sections 5-13 of a save block; missing sections are skipped.
+        // Returns false if none of the PC sections were found.
+        bool build(std::string_view buffer, const SectionInfo* sections);
+        
+        const uint8_t* data() const { return image.data(); }
+        size_t size() const { return image.size(); }
+        
+        // File offset of a logical offset, or 0 if it lies outside every section
+        size_t physicalAddress(size_t logicalOffset) const;
+        
+        const uint8_t* boxPokemon(size_t slot) const { return image.data() + slot * GEN3_BOX_POKEMON_SIZE; }
+        size_t boxPokemonOffset(size_t slot) const { return slot * GEN3_BOX_POKEMON_SIZE; }
+        
+    private:
+        struct Chunk {
+            size_t logicalStart;
+            size_t physicalStart;
+            size_t length;
+        };
+        
+        std::vector<uint8_t> image;
+        Chunk chunks[GEN3_PC_LAST_SECTION - GEN3_PC_FIRST_SECTION + 1];
+        size_t chunkCount = 0;
+    };
+    
     // Pokemon data structure helpers
-    uint32_t getPID(const std::string& buffer, size_t pokemonBaseAddr);
-    uint32_t getOTID(const std::string& buffer, size_t pokemonBaseAddr);
-    uint32_t getDecryptionKey(const std::string& buffer, size_t pokemonBaseAddr);
-    uint16_t getStoredPokemonChecksum(const std::string& buffer, size_t pokemonBaseAddr);
+    uint32_t getPID(std::string_view buffer, size_t pokemonBaseAddr);
+    uint32_t getOTID(std::string_view buffer, size_t pokemonBaseAddr);
+    uint32_t getDecryptionKey(std::string_view buffer, size_t pokemonBaseAddr);
+    uint16_t getStoredPokemonChecksum(std::string_view buffer, size_t pokemonBaseAddr);
     
     // Section helpers
     size_t findSectionOffset(const SectionInfo* sections, uint16_t sectionId);
     size_t findSectionOffset(const SectionInfo sections[], size_t numSections, uint16_t sectionId);
     
     // Security key and item encryption
-    uint32_t getSecurityKey(const std::string& buffer, int game, size_t section0Offset);
+    uint32_t getSecurityKey(std::string_view buffer, int game, size_t section0Offset);
     uint16_t decryptItemQuantity(uint16_t encryptedQty, int game, uint32_t securityKey);
     uint16_t encryptItemQuantity(uint16_t quantity, int game, uint32_t securityKey);
     
     // Checksum calculation
-    uint16_t calculateSectionChecksum(const std::string& buffer, size_t baseAddr, size_t dataSize);
-    uint16_t calculatePokemonDataChecksum(const std::string& buffer, size_t pokemonBaseAddr, uint32_t decryptionKey);
+    uint16_t calculateSectionChecksum(std::string_view buffer, size_t baseAddr, size_t dataSize);
+    uint16_t calculatePokemonDataChecksum(std::string_view buffer, size_t pokemonBaseAddr, uint32_t decryptionKey);
 }
 
 #endif // GENERATION3_UTILS_H
\ No newline at end of file
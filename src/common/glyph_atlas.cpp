@@ -0,0 +1,231 @@
+#include "glyph_atlas.h"
+
+namespace {
+
+// Decodes one UTF-8 sequence starting at text[pos]; malformed bytes decode
+// as U+FFFD and consume a single byte
+uint32_t decodeUTF8(std::string_view text, size_t& pos) {
+    unsigned char first = static_cast<unsigned char>(text[pos]);
+    size_t length = 1;
+    uint32_t codepoint = first;
+
+    if (first >= 0xF0 && first < 0xF8) {
+        length = 4;
+        codepoint = first & 0x07;
+    } else if (first >= 0xE0) {
+        length = 3;
+        codepoint = first & 0x0F;
+    } else if (first >= 0xC0) {
+        length = 2;
+        codepoint = first & 0x1F;
+    } else if (first >= 0x80) {
+        pos++;
+        return 0xFFFD;
+    }
+
+    if (length > 1) {
+        if (pos + length > text.size()) {
+            pos++;
+            return 0xFFFD;
+        }
+        for (size_t i = 1; i < length; i++) {
+            unsigned char next = static_cast<unsigned char>(text[pos + i]);
+            if ((next & 0xC0) != 0x80) {
+                pos++;
+                return 0xFFFD;
+            }
+            codepoint = (codepoint << 6) | (next & 0x3F);
+        }
+    }
+
+    pos += length;
+    return codepoint;
+}
+
+} // namespace
+
+// ============================================================================
+// Constructor / Destructor
+// ============================================================================
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font)
+    : renderer(renderer), font(font) {
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    if (texture) {
+        SDL_DestroyTexture(texture);
+    }
+}
+
+// ============================================================================
+// Atlas Texture
+// ============================================================================
+
+bool GlyphAtlas::createTexture() {
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                SDL_TEXTUREACCESS_STATIC, ATLAS_SIZE, ATLAS_SIZE);
+    if (!texture) {
+        return false;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    // Start fully transparent so the padding between glyphs samples as empty
+    std::vector<uint32_t> clear(static_cast<size_t>(ATLAS_SIZE) * ATLAS_SIZE, 0);
+    SDL_UpdateTexture(texture, nullptr, clear.data(), ATLAS_SIZE * 4);
+    return true;
+}
+
+void GlyphAtlas::reset() {
+    // Queued quads point at glyphs that are about to be overwritten
+    flush();
+    glyphs.clear();
+    shelfX = 0;
+    shelfY = 0;
+    shelfHeight = 0;
+}
+
+bool GlyphAtlas::pack(int w, int h, int& x, int& y) {
+    if (w + GLYPH_PADDING > ATLAS_SIZE || h + GLYPH_PADDING > ATLAS_SIZE) {
+        return false;
+    }
+    if (shelfX + w + GLYPH_PADDING > ATLAS_SIZE) {
+        shelfY += shelfHeight + GLYPH_PADDING;
+        shelfX = 0;
+        shelfHeight = 0;
+    }
+    if (shelfY + h + GLYPH_PADDING > ATLAS_SIZE) {
+        return false;
+    }
+
+    x = shelfX;
+    y = shelfY;
+    shelfX += w + GLYPH_PADDING;
+    if (h > shelfHeight) shelfHeight = h;
+    return true;
+}
+
+// ============================================================================
+// Glyph Cache
+// ============================================================================
+
+const GlyphAtlas::Glyph* GlyphAtlas::findOrAddGlyph(uint32_t codepoint, bool& atlasFull) {
+    atlasFull = false;
+    auto it = glyphs.find(codepoint);
+    if (it != glyphs.end()) {
+        return &it->second;
+    }
+
+    if (!texture && !createTexture()) {
+        return nullptr;
+    }
+
+    int minX, maxX, minY, maxY, advance;
+    if (!TTF_GetGlyphMetrics(font, codepoint, &minX, &maxX, &minY, &maxY, &advance)) {
+        return nullptr;
+    }
+
+    Glyph glyph{{0, 0, 0, 0}, advance};
+    const SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* surface = TTF_RenderGlyph_Blended(font, codepoint, white);
+
+    // Blank glyphs (spaces) only advance the pen
+    if (surface && surface->w > 0 && surface->h > 0) {
+        if (surface->format != SDL_PIXELFORMAT_ARGB8888) {
+            SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+            SDL_DestroySurface(surface);
+            surface = converted;
+            if (!surface) {
+                return nullptr;
+            }
+        }
+
+        int x, y;
+        if (!pack(surface->w, surface->h, x, y)) {
+            SDL_DestroySurface(surface);
+            atlasFull = true;
+            return nullptr;
+        }
+
+        SDL_Rect region = {x, y, surface->w, surface->h};
+        SDL_UpdateTexture(texture, &region, surface->pixels, surface->pitch);
+        glyph.source = {static_cast<float>(x), static_cast<float>(y),
+                        static_cast<float>(surface->w), static_cast<float>(surface->h)};
+    }
+    if (surface) {
+        SDL_DestroySurface(surface);
+    }
+
+    return &glyphs.emplace(codepoint, glyph).first->second;
+}
+
+// ============================================================================
+// Queueing and Drawing
+// ============================================================================
+
+bool GlyphAtlas::queueText(std::string_view text, float x, float y, SDL_Color color, float scale) {
+    pendingCodepoints.clear();
+    for (size_t pos = 0; pos < text.size();) {
+        pendingCodepoints.push_back(decodeUTF8(text, pos));
+    }
+
+    // Make sure every glyph is cached before emitting quads. If the atlas
+    // fills up part way, start over on an empty atlas; a string that doesn't
+    // fit even then is left to the caller.
+    for (int attempt = 0; ; attempt++) {
+        bool atlasFull = false;
+        for (uint32_t codepoint : pendingCodepoints) {
+            if (!findOrAddGlyph(codepoint, atlasFull)) {
+                if (!atlasFull) return false;
+                break;
+            }
+        }
+        if (!atlasFull) break;
+        if (attempt > 0) return false;
+        reset();
+    }
+
+    SDL_FColor tint = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+    const float texel = 1.0f / ATLAS_SIZE;
+    float penX = x;
+    uint32_t previous = 0;
+
+    for (uint32_t codepoint : pendingCodepoints) {
+        const Glyph& glyph = glyphs.find(codepoint)->second;
+
+        int kerning = 0;
+        if (previous != 0 && TTF_GetGlyphKerning(font, previous, codepoint, &kerning)) {
+            penX += kerning * scale;
+        }
+        previous = codepoint;
+
+        if (glyph.source.w > 0) {
+            float left = penX;
+            float top = y;
+            float right = penX + glyph.source.w * scale;
+            float bottom = y + glyph.source.h * scale;
+            float u0 = glyph.source.x * texel;
+            float v0 = glyph.source.y * texel;
+            float u1 = (glyph.source.x + glyph.source.w) * texel;
+            float v1 = (glyph.source.y + glyph.source.h) * texel;
+
+            int base = static_cast<int>(vertices.size());
+            vertices.push_back({{left, top}, tint, {u0, v0}});
+            vertices.push_back({{right, top}, tint, {u1, v0}});
+            vertices.push_back({{right, bottom}, tint, {u1, v1}});
+            vertices.push_back({{left, bottom}, tint, {u0, v1}});
+            indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+
+        penX += glyph.advance * scale;
+    }
+    return true;
+}
+
+void GlyphAtlas::flush() {
+    if (indices.empty()) return;
+    SDL_RenderGeometry(renderer, texture, vertices.data(), static_cast<int>(vertices.size()),
+                       indices.data(), static_cast<int>(indices.size()));
+    vertices.clear();
+    indices.clear();
+}
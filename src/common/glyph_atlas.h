@@ -0,0 +1,71 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// Glyph Atlas
+// ============================================================================
+// Every glyph of one font is rasterized once, in white, into a shared texture
+// owned by one renderer. Text is then queued as textured quads tinted through
+// the vertex color, and flush() draws everything queued with a single
+// SDL_RenderGeometry call. Nothing is uploaded to the GPU for text whose
+// glyphs are already cached. When the texture fills up it is cleared and
+// glyphs are rasterized again as they are needed.
+
+class GlyphAtlas {
+public:
+    GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font);
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    // Queues UTF-8 text with its top-left corner at (x, y). Returns false
+    // without queueing anything when a glyph can't be rasterized, so the
+    // caller can fall back to rendering the string directly.
+    bool queueText(std::string_view text, float x, float y, SDL_Color color, float scale = 1.0f);
+
+    // Draws and clears everything queued so far
+    void flush();
+
+    bool hasQueuedText() const { return !indices.empty(); }
+    SDL_Renderer* getRenderer() const { return renderer; }
+    TTF_Font* getFont() const { return font; }
+
+private:
+    struct Glyph {
+        SDL_FRect source;   // pixels in the atlas texture
+        int advance;
+    };
+
+    static constexpr int ATLAS_SIZE = 1024;
+    static constexpr int GLYPH_PADDING = 1;     // keeps linear filtering from bleeding
+
+    SDL_Renderer* renderer;
+    TTF_Font* font;
+    SDL_Texture* texture = nullptr;
+
+    std::unordered_map<uint32_t, Glyph> glyphs;
+    std::vector<uint32_t> pendingCodepoints;    // reused by queueText()
+
+    // Shelf packing cursor
+    int shelfX = 0;
+    int shelfY = 0;
+    int shelfHeight = 0;
+
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+
+    bool createTexture();
+    void reset();
+    const Glyph* findOrAddGlyph(uint32_t codepoint, bool& atlasFull);
+    bool pack(int w, int h, int& x, int& y);
+};
+
+#endif // GLYPH_ATLAS_H
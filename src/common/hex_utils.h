@@ -1,13 +1,18 @@
 #ifndef HEX_UTILS_H
 #define HEX_UTILS_H
 
+#include <array>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
 #include <cctype>
 #include <fstream>
 #include <vector>
+#include "frame_arena.h"
+#include "mapped_file.h"
 
 namespace HexUtils {
 
@@ -19,6 +24,14 @@ inline char toUpperHex(char c) {
     return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
 }
 
+// Value of one hex digit, or -1
+inline int hexDigitValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
 inline size_t parseHexAddress(const std::string& str) {
     size_t addr = 0;
     std::string s = str;
@@ -63,14 +76,79 @@ inline bool parseHexBytes(const std::string& hexStr, std::vector<unsigned char>&
     return true;
 }
 
-inline std::string toHexString(size_t value, int width = 0) {
-    std::stringstream ss;
-    ss << std::hex << std::uppercase;
-    if (width > 0) {
-        ss << std::setfill('0') << std::setw(width);
+// ============================================================================
+// Table-Driven Number Formatting
+// ============================================================================
+
+constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+
+// Two uppercase hex digits for every byte value
+constexpr std::array<char, 512> makeHexBytePairs() {
+    std::array<char, 512> pairs{};
+    for (int i = 0; i < 256; i++) {
+        pairs[i * 2] = HEX_DIGITS[i >> 4];
+        pairs[i * 2 + 1] = HEX_DIGITS[i & 0xF];
     }
-    ss << value;
-    return ss.str();
+    return pairs;
+}
+
+constexpr std::array<char, 512> HEX_BYTE_PAIRS = makeHexBytePairs();
+
+inline std::string_view byteHex(unsigned char byte) {
+    return std::string_view(&HEX_BYTE_PAIRS[byte * 2], 2);
+}
+
+// Writes value in uppercase hex, zero-padded to width, and returns the
+// number of characters written. out needs room for max(width, 16).
+inline size_t writeHex(char* out, uint64_t value, int width = 0) {
+    char digits[16];
+    size_t count = 0;
+    do {
+        digits[count++] = HEX_DIGITS[value & 0xF];
+        value >>= 4;
+    } while (value != 0);
+    
+    size_t length = 0;
+    for (int pad = width - static_cast<int>(count); pad > 0; pad--) {
+        out[length++] = '0';
+    }
+    while (count > 0) {
+        out[length++] = digits[--count];
+    }
+    return length;
+}
+
+// Writes value in decimal and returns the number of characters written.
+// out needs room for 20.
+inline size_t writeDecimal(char* out, uint64_t value) {
+    char digits[20];
+    size_t count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    
+    size_t length = 0;
+    while (count > 0) {
+        out[length++] = digits[--count];
+    }
+    return length;
+}
+
+// Formatted into the arena, valid until its next reset
+inline std::string_view toHexView(FrameArena& arena, uint64_t value, int width = 0) {
+    char* out = arena.allocate(static_cast<size_t>(std::max(width, 16)));
+    return std::string_view(out, writeHex(out, value, width));
+}
+
+inline std::string_view toDecimalView(FrameArena& arena, uint64_t value) {
+    char* out = arena.allocate(20);
+    return std::string_view(out, writeDecimal(out, value));
+}
+
+inline std::string toHexString(size_t value, int width = 0) {
+    char buffer[64];
+    return std::string(buffer, writeHex(buffer, value, std::min(width, 64)));
 }
 
 inline std::string formatFileSize(size_t size) {
@@ -110,6 +188,18 @@ inline bool loadFileToBuffer(const std::string& filename, std::string& buffer, s
     return true;
 }
 
+// Maps the file instead of copying it: ReadOnly for inspection, CopyOnWrite
+// when the buffer will be edited before saving
+inline bool loadFileToBuffer(const std::string& filename, MappedFile& buffer, size_t& fileSize,
+                             MappedFile::Mode mode) {
+    if (!buffer.open(filename, mode)) {
+        return false;
+    }
+    
+    fileSize = buffer.size();
+    return true;
+}
+
 } // namespace HexUtils
 
 #endif // HEX_UTILS_H
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include "mapped_file.h"
+#include <fstream>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// Constructor / Destructor
+// ============================================================================
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this == &other) return *this;
+    close();
+
+    length = other.length;
+    mapped = other.mapped;
+    mode = other.mode;
+    fallback = std::move(other.fallback);
+    bytes = mapped ? other.bytes : &fallback[0];
+
+    other.bytes = nullptr;
+    other.length = 0;
+    other.mapped = false;
+    return *this;
+}
+
+// ============================================================================
+// Open / Close
+// ============================================================================
+
+bool MappedFile::readIntoFallback(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+
+    std::streamoff end = file.tellg();
+    if (end < 0) {
+        return false;
+    }
+    file.seekg(0, std::ios::beg);
+
+    fallback.resize(static_cast<size_t>(end));
+    file.read(&fallback[0], end);
+    if (!file) {
+        fallback.clear();
+        return false;
+    }
+
+    bytes = &fallback[0];
+    length = fallback.size();
+    return true;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string& path, Mode openMode) {
+    close();
+    mode = openMode;
+    return readIntoFallback(path);
+}
+
+void MappedFile::close() {
+    fallback.clear();
+    bytes = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+bool MappedFile::makeWritable() {
+    mode = Mode::CopyOnWrite;
+    return true;
+}
+
+#else
+
+bool MappedFile::open(const std::string& path, Mode openMode) {
+    close();
+    mode = openMode;
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // mmap can't map zero bytes, and pipes/devices don't report a real size
+    if (!S_ISREG(info.st_mode) || info.st_size == 0) {
+        ::close(fd);
+        return readIntoFallback(path);
+    }
+
+    size_t fileLength = static_cast<size_t>(info.st_size);
+    int protection = (mode == Mode::CopyOnWrite) ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void* address = mmap(nullptr, fileLength, protection, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (address == MAP_FAILED) {
+        return readIntoFallback(path);
+    }
+
+    bytes = static_cast<char*>(address);
+    length = fileLength;
+    mapped = true;
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapped) {
+        munmap(bytes, length);
+    }
+    fallback.clear();
+    bytes = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+bool MappedFile::makeWritable() {
+    if (mode == Mode::CopyOnWrite) return true;
+    // A private mapping may gain PROT_WRITE even though the fd was read-only
+    if (mapped && mprotect(bytes, length, PROT_READ | PROT_WRITE) != 0) {
+        return false;
+    }
+    mode = Mode::CopyOnWrite;
+    return true;
+}
+
+#endif
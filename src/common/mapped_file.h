@@ -0,0 +1,60 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// ============================================================================
+// Mapped File
+// ============================================================================
+// A whole file mapped into memory instead of read into a heap buffer.
+//   ReadOnly     - PROT_READ private mapping; pages come straight from the
+//                  page cache, nothing is copied
+//   CopyOnWrite  - MAP_PRIVATE writable mapping; only pages that are actually
+//                  written get a private copy, the file itself never changes
+// Indexing and data() behave like the std::string buffers used elsewhere, and
+// the implicit std::string_view conversion lets it go anywhere DataUtils and
+// Generation3Utils accept a buffer. Where mmap is unavailable (Windows, empty
+// files, special files) the contents are read into an owned string instead.
+
+class MappedFile {
+public:
+    enum class Mode { ReadOnly, CopyOnWrite };
+
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool open(const std::string& path, Mode mode);
+    void close();
+
+    // Upgrades a ReadOnly mapping to CopyOnWrite in place
+    bool makeWritable();
+
+    const char* data() const { return bytes; }
+    char* data() { return bytes; }
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+    bool isMapped() const { return mapped; }
+
+    char operator[](size_t offset) const { return bytes[offset]; }
+    char& operator[](size_t offset) { return bytes[offset]; }
+
+    operator std::string_view() const { return std::string_view(bytes, length); }
+
+private:
+    char* bytes = nullptr;
+    size_t length = 0;
+    bool mapped = false;
+    Mode mode = Mode::ReadOnly;
+    std::string fallback;  // owns the contents when not mapped
+
+    bool readIntoFallback(const std::string& path);
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,226 @@
+#include "patch_writer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// Patch List
+// ============================================================================
+
+void PatchList::add(size_t offset, size_t length) {
+    if (length == 0) return;
+    size_t end = offset + length;
+
+    // Edits mostly arrive in ascending order, so appending is the common case
+    if (ranges.empty() || offset > ranges.back().offset + ranges.back().length) {
+        ranges.push_back(Range{offset, length});
+        return;
+    }
+
+    // First range that ends at or after offset, then swallow everything it touches
+    auto first = std::lower_bound(ranges.begin(), ranges.end(), offset,
+        [](const Range& range, size_t value) { return range.offset + range.length < value; });
+    auto last = first;
+    while (last != ranges.end() && last->offset <= end) {
+        offset = std::min(offset, last->offset);
+        end = std::max(end, last->offset + last->length);
+        ++last;
+    }
+
+    first = ranges.erase(first, last);
+    ranges.insert(first, Range{offset, end - offset});
+}
+
+size_t PatchList::byteCount() const {
+    size_t total = 0;
+    for (const auto& range : ranges) {
+        total += range.length;
+    }
+    return total;
+}
+
+// ============================================================================
+// Patch Writer
+// ============================================================================
+
+namespace PatchWriter {
+
+#ifdef _WIN32
+
+    // Windows builds read files instead of mapping them, so nothing can be
+    // reading the file while it is rewritten
+    bool writeWhole(const std::string& path, std::string_view buffer, size_t size) {
+        std::ofstream outFile(path, std::ios::binary);
+        if (!outFile) {
+            return false;
+        }
+        outFile.write(buffer.data(), static_cast<std::streamsize>(size));
+        outFile.close();
+        return !outFile.fail();
+    }
+
+    bool patchInPlace(const std::string& path, std::string_view buffer, size_t size,
+                      const PatchList&) {
+        return writeWhole(path, buffer, size);
+    }
+
+    bool copyAndPatch(const std::string&, const std::string& outputPath,
+                      std::string_view buffer, size_t size, const PatchList&) {
+        return writeWhole(outputPath, buffer, size);
+    }
+
+    bool save(const std::string&, const std::string& outputPath,
+              std::string_view buffer, size_t size, const PatchList&) {
+        return writeWhole(outputPath, buffer, size);
+    }
+
+#else
+
+    static bool pwriteAll(int fd, const char* data, size_t length, off_t offset) {
+        while (length > 0) {
+            ssize_t written = pwrite(fd, data, length, offset);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            data += written;
+            length -= static_cast<size_t>(written);
+            offset += written;
+        }
+        return true;
+    }
+
+    static bool applyPatches(int fd, std::string_view buffer, size_t size, const PatchList& patches) {
+        for (const auto& range : patches.getRanges()) {
+            if (range.offset >= size) break;
+            size_t length = std::min(range.length, size - range.offset);
+            if (!pwriteAll(fd, buffer.data() + range.offset, length, static_cast<off_t>(range.offset))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // The target may be the file `buffer` is mapped from (MAP_PRIVATE pages
+    // that were never written still read through to it), so truncating it
+    // in place could pull those pages out from under the buffer mid-write.
+    // The new contents go to a temporary file next to it instead, which is
+    // renamed over the target; an existing mapping keeps the old inode.
+    bool writeWhole(const std::string& path, std::string_view buffer, size_t size) {
+        std::string tempPath = path + ".tmpXXXXXX";
+        int fd = mkstemp(&tempPath[0]);
+        if (fd < 0) {
+            return false;
+        }
+
+        // Keep the permissions of the file being replaced
+        struct stat info;
+        mode_t mode = (stat(path.c_str(), &info) == 0) ? (info.st_mode & 07777) : 0644;
+
+        bool success = fchmod(fd, mode) == 0 && pwriteAll(fd, buffer.data(), size, 0);
+        if (close(fd) != 0) success = false;
+        if (success && rename(tempPath.c_str(), path.c_str()) != 0) success = false;
+        if (!success) {
+            int savedErrno = errno;
+            unlink(tempPath.c_str());
+            errno = savedErrno;
+        }
+        return success;
+    }
+
+    // Kernel-side copy first; anything it can't handle (cross-device, old
+    // kernels, non-Linux) finishes with a plain read/write loop
+    static bool copyContents(int inFd, int outFd, size_t size) {
+        size_t copied = 0;
+
+#ifdef __linux__
+        while (copied < size) {
+            ssize_t result = copy_file_range(inFd, nullptr, outFd, nullptr, size - copied, 0);
+            if (result < 0 && errno == EINTR) continue;
+            if (result <= 0) break;
+            copied += static_cast<size_t>(result);
+        }
+#endif
+
+        char chunk[65536];
+        while (copied < size) {
+            ssize_t result = pread(inFd, chunk, std::min(sizeof(chunk), size - copied), static_cast<off_t>(copied));
+            if (result < 0 && errno == EINTR) continue;
+            if (result <= 0) return false;
+            if (!pwriteAll(outFd, chunk, static_cast<size_t>(result), static_cast<off_t>(copied))) {
+                return false;
+            }
+            copied += static_cast<size_t>(result);
+        }
+        return true;
+    }
+
+    bool patchInPlace(const std::string& path, std::string_view buffer, size_t size,
+                      const PatchList& patches) {
+        int fd = open(path.c_str(), O_WRONLY);
+        if (fd < 0) {
+            return writeWhole(path, buffer, size);
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) != size) {
+            close(fd);
+            return writeWhole(path, buffer, size);
+        }
+
+        bool success = applyPatches(fd, buffer, size, patches);
+        if (close(fd) != 0) success = false;
+        return success;
+    }
+
+    bool copyAndPatch(const std::string& sourcePath, const std::string& outputPath,
+                      std::string_view buffer, size_t size, const PatchList& patches) {
+        int inFd = open(sourcePath.c_str(), O_RDONLY);
+        if (inFd < 0) {
+            return writeWhole(outputPath, buffer, size);
+        }
+
+        struct stat sourceInfo;
+        if (fstat(inFd, &sourceInfo) != 0 || static_cast<size_t>(sourceInfo.st_size) != size) {
+            close(inFd);
+            return writeWhole(outputPath, buffer, size);
+        }
+
+        // Truncating the output would destroy the source if both name the same file
+        struct stat outputInfo;
+        if (stat(outputPath.c_str(), &outputInfo) == 0 &&
+            outputInfo.st_dev == sourceInfo.st_dev && outputInfo.st_ino == sourceInfo.st_ino) {
+            close(inFd);
+            return patchInPlace(outputPath, buffer, size, patches);
+        }
+
+        int outFd = open(outputPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (outFd < 0) {
+            close(inFd);
+            return false;
+        }
+
+        bool success = copyContents(inFd, outFd, size) && applyPatches(outFd, buffer, size, patches);
+        close(inFd);
+        if (close(outFd) != 0) success = false;
+        return success;
+    }
+
+    bool save(const std::string& sourcePath, const std::string& outputPath,
+              std::string_view buffer, size_t size, const PatchList& patches) {
+        if (outputPath == sourcePath) {
+            return patchInPlace(outputPath, buffer, size, patches);
+        }
+        return copyAndPatch(sourcePath, outputPath, buffer, size, patches);
+    }
+
+#endif
+}
@@ -0,0 +1,64 @@
+#ifndef PATCH_WRITER_H
+#define PATCH_WRITER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ============================================================================
+// Patch List
+// ============================================================================
+// Byte ranges of an in-memory file image that differ from the file on disk.
+// Ranges are kept sorted by offset; overlapping or touching ranges are merged.
+
+class PatchList {
+public:
+    struct Range {
+        size_t offset;
+        size_t length;
+    };
+
+    void add(size_t offset, size_t length);
+    void clear() { ranges.clear(); }
+
+    bool empty() const { return ranges.empty(); }
+    size_t byteCount() const;
+    const std::vector<Range>& getRanges() const { return ranges; }
+
+private:
+    std::vector<Range> ranges;
+};
+
+// ============================================================================
+// Patch Writer
+// ============================================================================
+// Saves an edited buffer by writing only its patched ranges instead of the
+// whole file. Every function falls back to a full rewrite of buffer when the
+// file on disk doesn't have the expected size (or on platforms without
+// pwrite), so the result always matches buffer. Errors are reported through
+// the return value and errno; callers print their own messages.
+
+namespace PatchWriter {
+
+    // path must still hold buffer's original contents outside the patched ranges
+    bool patchInPlace(const std::string& path, std::string_view buffer, size_t size,
+                      const PatchList& patches);
+
+    // Creates outputPath as a copy of sourcePath (copy_file_range where
+    // available, so the copy can stay inside the kernel or on the file
+    // server), then writes the patched ranges over it
+    bool copyAndPatch(const std::string& sourcePath, const std::string& outputPath,
+                      std::string_view buffer, size_t size, const PatchList& patches);
+
+    // patchInPlace when outputPath is sourcePath, copyAndPatch otherwise
+    bool save(const std::string& sourcePath, const std::string& outputPath,
+              std::string_view buffer, size_t size, const PatchList& patches);
+
+    // Whole-buffer write, used as the fallback. Never truncates the existing
+    // file in place, since buffer may be mapped from it: the data goes to a
+    // temporary file that replaces it.
+    bool writeWhole(const std::string& path, std::string_view buffer, size_t size);
+}
+
+#endif // PATCH_WRITER_H
@@ -13,6 +13,7 @@ SDLAppBase::SDLAppBase(const std::string& title, int width, int height)
     , largeFont(nullptr)
     , regularFont(nullptr)
     , japaneseFont(nullptr)
+    , textBatchDepth(0)
     , windowTitle(title)
     , windowWidth(width)
     , windowHeight(height)
@@ -21,7 +22,11 @@ SDLAppBase::SDLAppBase(const std::string& title, int width, int height)
     , japaneseCharWidth(0)
     , running(false)
     , needsRedraw(true)
-    , confirmOnQuit(false) {
+    , fullFrame(false)
+    , confirmOnQuit(false)
+    , frameCanvas(nullptr)
+    , canvasWidth(0)
+    , canvasHeight(0) {
 }
 
 SDLAppBase::~SDLAppBase() {
@@ -66,56 +71,167 @@ bool SDLAppBase::init() {
 
 void SDLAppBase::run() {
     running = true;
-    SDL_Event event;
-    Uint32 lastTime = SDL_GetTicks();
+    Uint64 lastTime = SDL_GetTicks();
+    Uint64 lastFrameTime = 0;
     
     while (running) {
-        Uint32 currentTime = SDL_GetTicks();
-        float deltaTime = (currentTime - lastTime) / 1000.0f;
-        lastTime = currentTime;
+        // Sleep until an event arrives. While a frame is pending or something
+        // is animating, sleep only until the next frame is due, so a burst
+        // of key repeats or wheel events lands in a single frame.
+        bool framePending = needsRedraw || !dirtyRegions.empty() || isAnimating();
+        Sint32 timeout = IDLE_WAIT_MS;
+        if (framePending) {
+            Uint64 sinceFrame = SDL_GetTicks() - lastFrameTime;
+            timeout = (sinceFrame >= FRAME_INTERVAL_MS) ? 0
+                    : static_cast<Sint32>(FRAME_INTERVAL_MS - sinceFrame);
+        }
         
-        while (SDL_PollEvent(&event)) {
-            if (event.type == SDL_EVENT_QUIT) {
-                if (confirmOnQuit) {
-                    if (showQuitConfirmDialog()) {
-                        running = false;
-                    }
-                } else {
-                    running = false;
-                }
-                continue;
-            }
-
-            if (event.type == SDL_EVENT_WINDOW_RESIZED ||
-                event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) {
-                windowWidth = event.window.data1;
-                windowHeight = event.window.data2;
-                onResize(windowWidth, windowHeight);
-                continue;
-            }
-
-            if (event.type == SDL_EVENT_WINDOW_EXPOSED) {
-                needsRedraw = true;
-                continue;
+        SDL_Event event;
+        if (SDL_WaitEventTimeout(&event, timeout)) {
+            dispatchEvent(event);
+            while (running && SDL_PollEvent(&event)) {
+                dispatchEvent(event);
             }
-            
-            handleEvent(event);
+        }
+        if (!running) break;
+        
+        Uint64 currentTime = SDL_GetTicks();
+        if (currentTime - lastFrameTime < FRAME_INTERVAL_MS) {
+            continue;
         }
         
+        // A long idle wait must not turn into one huge animation step
+        float deltaTime = std::min((currentTime - lastTime) / 1000.0f, MAX_UPDATE_STEP);
+        lastTime = currentTime;
         update(deltaTime);
         
-        if (needsRedraw) {
-            render();
-            needsRedraw = false;
+        if (needsRedraw || !dirtyRegions.empty()) {
+            renderFrame();
+            lastFrameTime = currentTime;
+        }
+    }
+}
+
+void SDLAppBase::dispatchEvent(SDL_Event& event) {
+    if (event.type == SDL_EVENT_QUIT) {
+        if (confirmOnQuit) {
+            if (showQuitConfirmDialog()) {
+                running = false;
+            }
         } else {
-            SDL_Delay(10);
+            running = false;
+        }
+        return;
+    }
+
+    if (event.type == SDL_EVENT_WINDOW_RESIZED ||
+        event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) {
+        windowWidth = event.window.data1;
+        windowHeight = event.window.data2;
+        onResize(windowWidth, windowHeight);
+        return;
+    }
+
+    if (event.type == SDL_EVENT_WINDOW_EXPOSED) {
+        needsRedraw = true;
+        return;
+    }
+    
+    handleEvent(event);
+}
+
+bool SDLAppBase::isAnimating() const {
+    return scrollbar.velocity != 0;
+}
+
+// ============================================================================
+// Frame Rendering
+// ============================================================================
+
+void SDLAppBase::markDirty(const SDL_Rect& rect) {
+    if (rect.w <= 0 || rect.h <= 0) return;
+    dirtyRegions.push_back(rect);
+}
+
+bool SDLAppBase::isRegionDirty(const SDL_Rect& rect) const {
+    if (fullFrame) return true;
+    for (const SDL_Rect& dirty : dirtyRegions) {
+        if (SDL_HasRectIntersection(&dirty, &rect)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SDLAppBase::clearDirtyRegions(SDL_Color color) {
+    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+    if (fullFrame) {
+        SDL_RenderClear(renderer);
+        return;
+    }
+    for (const SDL_Rect& dirty : dirtyRegions) {
+        SDL_FRect area{
+            static_cast<float>(dirty.x),
+            static_cast<float>(dirty.y),
+            static_cast<float>(dirty.w),
+            static_cast<float>(dirty.h)
+        };
+        SDL_RenderFillRect(renderer, &area);
+    }
+}
+
+void SDLAppBase::renderFrame() {
+    int outputWidth = 0, outputHeight = 0;
+    SDL_GetCurrentRenderOutputSize(renderer, &outputWidth, &outputHeight);
+    
+    // The window's back buffer is undefined after a present, so frames are
+    // drawn into a persistent canvas that keeps everything not redrawn
+    if (!frameCanvas || canvasWidth != outputWidth || canvasHeight != outputHeight) {
+        if (frameCanvas) {
+            SDL_DestroyTexture(frameCanvas);
+        }
+        frameCanvas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                        SDL_TEXTUREACCESS_TARGET, outputWidth, outputHeight);
+        canvasWidth = outputWidth;
+        canvasHeight = outputHeight;
+        needsRedraw = true;
+    }
+    
+    // Without render target support every frame is a full repaint
+    fullFrame = needsRedraw || !frameCanvas;
+    if (frameCanvas) {
+        SDL_SetRenderTarget(renderer, frameCanvas);
+        if (!fullFrame) {
+            SDL_Rect bounds = dirtyRegions.front();
+            for (const SDL_Rect& dirty : dirtyRegions) {
+                SDL_GetRectUnion(&bounds, &dirty, &bounds);
+            }
+            SDL_SetRenderClipRect(renderer, &bounds);
         }
     }
+    
+    frameArena.reset();
+    render();
+    
+    if (frameCanvas) {
+        SDL_SetRenderClipRect(renderer, nullptr);
+        SDL_SetRenderTarget(renderer, nullptr);
+        SDL_RenderTexture(renderer, frameCanvas, nullptr, nullptr);
+    }
+    SDL_RenderPresent(renderer);
+    
+    needsRedraw = false;
+    fullFrame = false;
+    dirtyRegions.clear();
 }
 
 void SDLAppBase::cleanup() {
     SDL_StopTextInput(window);
     
+    // Atlas textures belong to the renderer and are keyed by font
+    glyphAtlases.clear();
+    clearScaledFontCache();
+    
     if (japaneseFont) {
         TTF_CloseFont(japaneseFont);
         japaneseFont = nullptr;
@@ -129,6 +245,10 @@ void SDLAppBase::cleanup() {
         font = nullptr;
         regularFont = nullptr;
     }
+    if (frameCanvas) {
+        SDL_DestroyTexture(frameCanvas);
+        frameCanvas = nullptr;
+    }
     if (renderer) {
         SDL_DestroyRenderer(renderer);
         renderer = nullptr;
@@ -178,6 +298,8 @@ bool SDLAppBase::loadFonts(int normalSize, int largeSize) {
         nullptr
     };
     
+    clearScaledFontCache();
+    
     for (int i = 0; fontPaths[i] != nullptr; i++) {
         font = TTF_OpenFont(fontPaths[i], normalSize);
         if (font) {
@@ -214,6 +336,8 @@ bool SDLAppBase::loadJapaneseFont(int size) {
         nullptr
     };
     
+    clearScaledFontCache();
+    
     for (int i = 0; japaneseFontPaths[i] != nullptr; i++) {
         japaneseFont = TTF_OpenFont(japaneseFontPaths[i], size);
         if (japaneseFont) {
@@ -234,12 +358,44 @@ bool SDLAppBase::loadJapaneseFont(int size) {
 
 TTF_Font* SDLAppBase::loadScaledFont(int size) {
     if (currentFontPath.empty()) return nullptr;
-    return TTF_OpenFont(currentFontPath.c_str(), size);
+    return getCachedFont(currentFontPath, size);
 }
 
 TTF_Font* SDLAppBase::loadScaledJapaneseFont(int size) {
     if (currentJapaneseFontPath.empty()) return nullptr;
-    return TTF_OpenFont(currentJapaneseFontPath.c_str(), size);
+    return getCachedFont(currentJapaneseFontPath, size);
+}
+
+TTF_Font* SDLAppBase::getCachedFont(const std::string& path, int size) {
+    for (auto it = scaledFonts.begin(); it != scaledFonts.end(); ++it) {
+        if (it->size == size && it->path == path) {
+            scaledFonts.splice(scaledFonts.begin(), scaledFonts, it);
+            return it->font;
+        }
+    }
+    
+    if (scaledFonts.size() >= SCALED_FONT_CACHE_CAPACITY) {
+        TTF_Font* evicted = scaledFonts.back().font;
+        if (evicted) {
+            releaseGlyphAtlases(evicted);
+            TTF_CloseFont(evicted);
+        }
+        scaledFonts.pop_back();
+    }
+    
+    TTF_Font* opened = TTF_OpenFont(path.c_str(), size);
+    scaledFonts.push_front({path, size, opened});
+    return opened;
+}
+
+void SDLAppBase::clearScaledFontCache() {
+    for (const ScaledFontEntry& entry : scaledFonts) {
+        if (entry.font) {
+            releaseGlyphAtlases(entry.font);
+            TTF_CloseFont(entry.font);
+        }
+    }
+    scaledFonts.clear();
 }
 
 // ============================================================================
@@ -254,7 +410,7 @@ size_t SDLAppBase::getUTF8CharLength(unsigned char firstByte) {
     return 1;  // Invalid, treat as single byte
 }
 
-bool SDLAppBase::isCombiningDakuten(const std::string& text, size_t pos) {
+bool SDLAppBase::isCombiningDakuten(std::string_view text, size_t pos) {
     // Check if we have enough bytes for a 3-byte UTF-8 character
     if (pos + 2 >= text.length()) return false;
     
@@ -272,7 +428,7 @@ bool SDLAppBase::isCombiningDakuten(const std::string& text, size_t pos) {
     return false;
 }
 
-UTF8CharInfo SDLAppBase::analyzeUTF8Char(const std::string& text, size_t pos) const {
+UTF8CharInfo SDLAppBase::analyzeUTF8Char(std::string_view text, size_t pos) const {
     UTF8CharInfo info = {1, false, false, false, 1};
     
     if (pos >= text.length()) return info;
@@ -314,13 +470,15 @@ UTF8CharInfo SDLAppBase::analyzeUTF8Char(const std::string& text, size_t pos) co
 // Basic Text Rendering
 // ============================================================================
 
-void SDLAppBase::renderText(const std::string& text, int x, int y, SDL_Color color, 
+void SDLAppBase::renderText(std::string_view text, int x, int y, SDL_Color color, 
                            TTF_Font* f, SDL_Renderer* targetRenderer) {
     if (text.empty()) return;
     if (!f) f = font;
     if (!targetRenderer) targetRenderer = renderer;
     
-    SDL_Surface* surface = TTF_RenderText_Blended(f, text.c_str(), text.size(), color);
+    if (queueAtlasText(text, x, y, color, 1.0f, f, targetRenderer)) return;
+    
+    SDL_Surface* surface = TTF_RenderText_Blended(f, text.data(), text.size(), color);
     if (!surface) return;
     
     SDL_Texture* texture = SDL_CreateTextureFromSurface(targetRenderer, surface);
@@ -341,13 +499,15 @@ void SDLAppBase::renderText(const std::string& text, int x, int y, SDL_Color col
     SDL_DestroySurface(surface);
 }
 
-void SDLAppBase::renderTextScaled(const std::string& text, int x, int y, SDL_Color color,
+void SDLAppBase::renderTextScaled(std::string_view text, int x, int y, SDL_Color color,
                                   float scale, TTF_Font* f, SDL_Renderer* targetRenderer) {
     if (text.empty()) return;
     if (!f) f = font;
     if (!targetRenderer) targetRenderer = renderer;
     
-    SDL_Surface* surface = TTF_RenderText_Blended(f, text.c_str(), text.size(), color);
+    if (queueAtlasText(text, x, y, color, scale, f, targetRenderer)) return;
+    
+    SDL_Surface* surface = TTF_RenderText_Blended(f, text.data(), text.size(), color);
     if (!surface) return;
     
     SDL_Texture* texture = SDL_CreateTextureFromSurface(targetRenderer, surface);
@@ -384,9 +544,64 @@ void SDLAppBase::renderCenteredTextAt(const std::string& text, int x, int y, SDL
     renderText(text, x - w / 2, y - h / 2, color, f, targetRenderer);
 }
 
-void SDLAppBase::getTextSize(const std::string& text, int& w, int& h, TTF_Font* f) {
+void SDLAppBase::getTextSize(std::string_view text, int& w, int& h, TTF_Font* f) {
     if (!f) f = font;
-    TTF_GetStringSize(f, text.c_str(), 0, &w, &h);
+    TTF_GetStringSize(f, text.data(), text.size(), &w, &h);
+}
+
+// ============================================================================
+// Batched Text Rendering
+// ============================================================================
+
+GlyphAtlas* SDLAppBase::getGlyphAtlas(TTF_Font* f, SDL_Renderer* targetRenderer) {
+    if (!f || !targetRenderer) return nullptr;
+    for (const auto& atlas : glyphAtlases) {
+        if (atlas->getFont() == f && atlas->getRenderer() == targetRenderer) {
+            return atlas.get();
+        }
+    }
+    glyphAtlases.push_back(std::make_unique<GlyphAtlas>(targetRenderer, f));
+    return glyphAtlases.back().get();
+}
+
+void SDLAppBase::releaseGlyphAtlases(SDL_Renderer* targetRenderer) {
+    glyphAtlases.erase(std::remove_if(glyphAtlases.begin(), glyphAtlases.end(),
+                                      [&](const std::unique_ptr<GlyphAtlas>& atlas) {
+                                          return atlas->getRenderer() == targetRenderer;
+                                      }),
+                       glyphAtlases.end());
+}
+
+void SDLAppBase::releaseGlyphAtlases(TTF_Font* f) {
+    glyphAtlases.erase(std::remove_if(glyphAtlases.begin(), glyphAtlases.end(),
+                                      [&](const std::unique_ptr<GlyphAtlas>& atlas) {
+                                          return atlas->getFont() == f;
+                                      }),
+                       glyphAtlases.end());
+}
+
+bool SDLAppBase::queueAtlasText(std::string_view text, int x, int y, SDL_Color color,
+                                float scale, TTF_Font* f, SDL_Renderer* targetRenderer) {
+    GlyphAtlas* atlas = getGlyphAtlas(f, targetRenderer);
+    if (!atlas || !atlas->queueText(text, static_cast<float>(x), static_cast<float>(y), color, scale)) {
+        return false;
+    }
+    if (textBatchDepth == 0) {
+        atlas->flush();
+    }
+    return true;
+}
+
+void SDLAppBase::beginTextBatch() {
+    textBatchDepth++;
+}
+
+void SDLAppBase::flushTextBatch() {
+    if (textBatchDepth > 0) textBatchDepth--;
+    if (textBatchDepth > 0) return;
+    for (const auto& atlas : glyphAtlases) {
+        atlas->flush();
+    }
 }
 
 // ============================================================================
@@ -456,8 +671,6 @@ void SDLAppBase::renderMixedTextScaled(const std::string& text, int x, int y, SD
     
     // If we couldn't load scaled fonts, fall back to texture scaling
     if (!scaledLatinFont || !scaledJapaneseFont) {
-        if (scaledLatinFont) TTF_CloseFont(scaledLatinFont);
-        if (scaledJapaneseFont) TTF_CloseFont(scaledJapaneseFont);
         renderMixedTextScaledViaTexture(text, x, y, color, scale, latinFont, targetRenderer);
         return;
     }
@@ -490,9 +703,6 @@ void SDLAppBase::renderMixedTextScaled(const std::string& text, int x, int y, SD
         
         i += charInfo.byteLength;
     }
-    
-    TTF_CloseFont(scaledLatinFont);
-    TTF_CloseFont(scaledJapaneseFont);
 }
 
 void SDLAppBase::renderMixedTextScaledViaTexture(const std::string& text, int x, int y, 
@@ -583,7 +793,7 @@ void SDLAppBase::renderMixedTextScaledViaTexture(const std::string& text, int x,
 // Cell-Based Text Rendering (Fixed-Width Cells)
 // ============================================================================
 
-void SDLAppBase::renderMixedTextWithCellWidth(const std::string& text, int x, int y, 
+void SDLAppBase::renderMixedTextWithCellWidth(std::string_view text, int x, int y, 
                                                SDL_Color color, int cellWidth, 
                                                TTF_Font* latinFont,
                                                SDL_Renderer* targetRenderer) {
@@ -603,18 +813,24 @@ void SDLAppBase::renderMixedTextWithCellWidth(const std::string& text, int x, in
         }
         
         // Get the string to render (include following combining mark if present)
-        std::string charToRender = text.substr(i, charInfo.totalLength);
+        std::string_view charToRender = text.substr(i, charInfo.totalLength);
         
         TTF_Font* fontToUse = (charInfo.isMultiByte && japaneseFont) ? japaneseFont : latinFont;
         
         int charW, charH;
-        TTF_GetStringSize(fontToUse, charToRender.c_str(), charToRender.size(), &charW, &charH);
+        TTF_GetStringSize(fontToUse, charToRender.data(), charToRender.size(), &charW, &charH);
         
         // Center the character in the cell
         int offsetX = std::max(0, (cellWidth - charW) / 2);
         
-        SDL_Surface* surface = TTF_RenderText_Blended(fontToUse, charToRender.c_str(), 
-                                                      charToRender.size(), color);
+        // A base character with a combining mark needs shaping, so only
+        // plain characters go through the glyph atlas
+        SDL_Surface* surface = nullptr;
+        if (charInfo.hasFollowingCombiningMark ||
+            !queueAtlasText(charToRender, currentX + offsetX, y, color, 1.0f, fontToUse, targetRenderer)) {
+            surface = TTF_RenderText_Blended(fontToUse, charToRender.data(), 
+                                             charToRender.size(), color);
+        }
         if (surface) {
             SDL_Texture* texture = SDL_CreateTextureFromSurface(targetRenderer, surface);
             if (texture) {
@@ -639,7 +855,7 @@ void SDLAppBase::renderMixedTextWithCellWidth(const std::string& text, int x, in
     }
 }
 
-void SDLAppBase::renderMixedTextScaledWithCellWidth(const std::string& text, int x, int y, 
+void SDLAppBase::renderMixedTextScaledWithCellWidth(std::string_view text, int x, int y, 
                                                      SDL_Color color, float scale, 
                                                      int baseCellWidth,
                                                      TTF_Font* latinFont, 
@@ -664,7 +880,6 @@ void SDLAppBase::renderMixedTextScaledWithCellWidth(const std::string& text, int
     // Fall back to non-scaled rendering if font loading fails
     if (!scaledLatinFont) {
         renderMixedTextWithCellWidth(text, x, y, color, scaledCellWidth, latinFont, targetRenderer);
-        if (scaledJapaneseFont) TTF_CloseFont(scaledJapaneseFont);
         return;
     }
     
@@ -679,18 +894,22 @@ void SDLAppBase::renderMixedTextScaledWithCellWidth(const std::string& text, int
             currentX -= scaledCellWidth;
         }
         
-        std::string charToRender = text.substr(i, charInfo.totalLength);
+        std::string_view charToRender = text.substr(i, charInfo.totalLength);
         
         TTF_Font* fontToUse = (charInfo.isMultiByte && scaledJapaneseFont) 
                              ? scaledJapaneseFont : scaledLatinFont;
         
         int charW, charH;
-        TTF_GetStringSize(fontToUse, charToRender.c_str(), charToRender.size(), &charW, &charH);
+        TTF_GetStringSize(fontToUse, charToRender.data(), charToRender.size(), &charW, &charH);
         
         int offsetX = std::max(0, (scaledCellWidth - charW) / 2);
         
-        SDL_Surface* surface = TTF_RenderText_Blended(fontToUse, charToRender.c_str(), 
-                                                      charToRender.size(), color);
+        SDL_Surface* surface = nullptr;
+        if (charInfo.hasFollowingCombiningMark ||
+            !queueAtlasText(charToRender, currentX + offsetX, y, color, 1.0f, fontToUse, targetRenderer)) {
+            surface = TTF_RenderText_Blended(fontToUse, charToRender.data(), 
+                                             charToRender.size(), color);
+        }
         if (surface) {
             SDL_Texture* texture = SDL_CreateTextureFromSurface(targetRenderer, surface);
             if (texture) {
@@ -712,9 +931,6 @@ void SDLAppBase::renderMixedTextScaledWithCellWidth(const std::string& text, int
         
         i += charInfo.totalLength;
     }
-    
-    TTF_CloseFont(scaledLatinFont);
-    if (scaledJapaneseFont) TTF_CloseFont(scaledJapaneseFont);
 }
 
 // ============================================================================
@@ -775,6 +991,35 @@ void SDLAppBase::renderButton(const SDL_Rect& rect, const std::string& text, boo
     renderText(text, textX, textY, colors.text, nullptr, targetRenderer);
 }
 
+void SDLAppBase::renderSuggestionList(int x, int y, const std::string_view* items, size_t count,
+                                      size_t selected, SDL_Renderer* targetRenderer) {
+    if (!targetRenderer) targetRenderer = renderer;
+    if (count == 0) return;
+
+    int widest = 0;
+    for (size_t i = 0; i < count; i++) {
+        int textW, textH;
+        getTextSize(items[i], textW, textH);
+        widest = std::max(widest, textW);
+    }
+
+    const int padding = 4;
+    int lineH = charHeight + 2;
+    SDL_Rect box = {x, y, widest + padding * 2, static_cast<int>(count) * lineH + padding * 2};
+    renderFilledRect(box, colors.dialogBg, targetRenderer);
+    renderOutlineRect(box, colors.dialogBorder, targetRenderer);
+
+    for (size_t i = 0; i < count; i++) {
+        int lineY = y + padding + static_cast<int>(i) * lineH;
+        if (i == selected) {
+            SDL_Rect lineRect = {x + 1, lineY, box.w - 2, lineH};
+            renderFilledRect(lineRect, colors.selectedBg, targetRenderer);
+        }
+        renderText(items[i], x + padding, lineY + 1,
+                   (i == selected) ? colors.highlight : colors.text, nullptr, targetRenderer);
+    }
+}
+
 bool SDLAppBase::isPointInRect(int x, int y, const SDL_Rect& rect) {
     return x >= rect.x && x < rect.x + rect.w &&
            y >= rect.y && y < rect.y + rect.h;
@@ -803,6 +1048,12 @@ void SDLAppBase::getScrollbarGeometry(int& sbX, int& sbY, int& sbHeight,
     }
 }
 
+SDL_Rect SDLAppBase::getScrollbarRect() const {
+    int sbX, sbY, sbHeight, thumbY, thumbHeight;
+    getScrollbarGeometry(sbX, sbY, sbHeight, thumbY, thumbHeight);
+    return {sbX, sbY, scrollbar.width, sbHeight};
+}
+
 void SDLAppBase::renderScrollbar(SDL_Renderer* targetRenderer) {
     if (!targetRenderer) targetRenderer = renderer;
     
@@ -833,12 +1084,12 @@ bool SDLAppBase::handleScrollbarClick(int x, int y) {
         scrollbar.dragStartY = y;
         scrollbar.dragStartRatio = static_cast<float>(scrollbar.offset) / 
                                    static_cast<float>(scrollbar.maxOffset());
+        markDirty(getScrollbarRect());
     } else {
         float clickRatio = static_cast<float>(y - sbY) / static_cast<float>(sbHeight);
         scrollToRatio(clickRatio);
     }
     
-    needsRedraw = true;
     return true;
 }
 
@@ -858,7 +1109,7 @@ void SDLAppBase::handleScrollbarDrag(int y) {
 void SDLAppBase::handleScrollbarRelease() {
     if (scrollbar.dragging) {
         scrollbar.dragging = false;
-        needsRedraw = true;
+        markDirty(getScrollbarRect());
     }
 }
 
@@ -925,7 +1176,6 @@ void SDLAppBase::updateMomentumScroll(float deltaTime) {
         float scrollDelta = scrollbar.velocity * deltaTime * 60.0f;
         scrollBySmooth(scrollDelta);
         scrollbar.velocity *= ScrollbarState::FRICTION;
-        needsRedraw = true;
     } else if (scrollbar.velocity != 0) {
         scrollbar.velocity = 0;
         scrollbar.accumulatedScroll = 0;
@@ -1064,6 +1314,7 @@ bool SDLAppBase::showConfirmDialog(const ConfirmDialogConfig& config) {
         SDL_Delay(16);
     }
     
+    releaseGlyphAtlases(dialogRenderer);
     SDL_DestroyRenderer(dialogRenderer);
     SDL_DestroyWindow(dialogWindow);
     
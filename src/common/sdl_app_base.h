@@ -3,9 +3,15 @@
 
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
+#include "frame_arena.h"
+#include "glyph_atlas.h"
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <functional>
+#include <list>
+#include <memory>
+#include <vector>
 
 // ============================================================================
 // Color Scheme
@@ -126,6 +132,19 @@ protected:
     std::string currentFontPath;
     std::string currentJapaneseFontPath;
     
+    // Scaled fonts opened for zoomed rendering, most recently used first
+    struct ScaledFontEntry {
+        std::string path;
+        int size;
+        TTF_Font* font;     // nullptr caches a failed open
+    };
+    static constexpr size_t SCALED_FONT_CACHE_CAPACITY = 8;
+    std::list<ScaledFontEntry> scaledFonts;
+    
+    // One glyph atlas per font and renderer, created on first use
+    std::vector<std::unique_ptr<GlyphAtlas>> glyphAtlases;
+    int textBatchDepth;
+    
     // ========================================================================
     // Window Properties
     // ========================================================================
@@ -144,9 +163,27 @@ protected:
     // Application State
     // ========================================================================
     bool running;
-    bool needsRedraw;
+    bool needsRedraw;       // repaint the whole window on the next frame
+    bool fullFrame;         // true inside render() when everything is repainted
     bool confirmOnQuit;
     
+    // ========================================================================
+    // Frame Scheduling
+    // ========================================================================
+    static constexpr Uint64 FRAME_INTERVAL_MS = 16;
+    static constexpr Sint32 IDLE_WAIT_MS = 1000;
+    static constexpr float MAX_UPDATE_STEP = 0.05f;
+    
+    // Partial repaints are drawn into a persistent canvas; only the dirty
+    // regions are cleared and redrawn
+    std::vector<SDL_Rect> dirtyRegions;
+    SDL_Texture* frameCanvas;
+    int canvasWidth;
+    int canvasHeight;
+    
+    // Scratch text for the frame being rendered, reset before each render()
+    FrameArena frameArena;
+    
     // ========================================================================
     // Visual Configuration
     // ========================================================================
@@ -158,29 +195,46 @@ protected:
     // ========================================================================
     bool loadFonts(int normalSize = 14, int largeSize = 48);
     bool loadJapaneseFont(int size = 14);
+    // Scaled fonts come from an LRU cache that owns them; don't close them
     TTF_Font* loadScaledFont(int size);
     TTF_Font* loadScaledJapaneseFont(int size);
+    TTF_Font* getCachedFont(const std::string& path, int size);
+    void clearScaledFontCache();
     
     // ========================================================================
     // UTF-8 Text Analysis
     // ========================================================================
     static size_t getUTF8CharLength(unsigned char firstByte);
-    static bool isCombiningDakuten(const std::string& text, size_t pos);
-    UTF8CharInfo analyzeUTF8Char(const std::string& text, size_t pos) const;
+    static bool isCombiningDakuten(std::string_view text, size_t pos);
+    UTF8CharInfo analyzeUTF8Char(std::string_view text, size_t pos) const;
     
     // ========================================================================
     // Basic Text Rendering
     // ========================================================================
-    void renderText(const std::string& text, int x, int y, SDL_Color color,
+    void renderText(std::string_view text, int x, int y, SDL_Color color,
                    TTF_Font* f = nullptr, SDL_Renderer* targetRenderer = nullptr);
-    void renderTextScaled(const std::string& text, int x, int y, SDL_Color color, 
+    void renderTextScaled(std::string_view text, int x, int y, SDL_Color color, 
                          float scale, TTF_Font* f = nullptr, 
                          SDL_Renderer* targetRenderer = nullptr);
     void renderCenteredText(const std::string& text, int y, SDL_Color color, 
                            TTF_Font* f = nullptr, SDL_Renderer* targetRenderer = nullptr);
     void renderCenteredTextAt(const std::string& text, int x, int y, SDL_Color color,
                              TTF_Font* f = nullptr, SDL_Renderer* targetRenderer = nullptr);
-    void getTextSize(const std::string& text, int& w, int& h, TTF_Font* f = nullptr);
+    void getTextSize(std::string_view text, int& w, int& h, TTF_Font* f = nullptr);
+    
+    // ========================================================================
+    // Batched Text Rendering
+    // ========================================================================
+    // Between beginTextBatch() and flushTextBatch(), renderText() and
+    // renderTextScaled() only queue glyph quads; the flush draws them with one
+    // SDL_RenderGeometry call per atlas, on top of anything drawn meanwhile.
+    void beginTextBatch();
+    void flushTextBatch();
+    GlyphAtlas* getGlyphAtlas(TTF_Font* f, SDL_Renderer* targetRenderer);
+    void releaseGlyphAtlases(SDL_Renderer* targetRenderer);
+    void releaseGlyphAtlases(TTF_Font* f);
+    bool queueAtlasText(std::string_view text, int x, int y, SDL_Color color,
+                        float scale, TTF_Font* f, SDL_Renderer* targetRenderer);
     
     // ========================================================================
     // Mixed Text Rendering (Latin + Japanese)
@@ -199,11 +253,11 @@ protected:
     // ========================================================================
     // Cell-Based Text Rendering (Fixed-Width Cells)
     // ========================================================================
-    void renderMixedTextWithCellWidth(const std::string& text, int x, int y, 
+    void renderMixedTextWithCellWidth(std::string_view text, int x, int y, 
                                       SDL_Color color, int cellWidth, 
                                       TTF_Font* latinFont = nullptr,
                                       SDL_Renderer* targetRenderer = nullptr);
-    void renderMixedTextScaledWithCellWidth(const std::string& text, int x, int y, 
+    void renderMixedTextScaledWithCellWidth(std::string_view text, int x, int y, 
                                             SDL_Color color, float scale, 
                                             int baseCellWidth, 
                                             TTF_Font* latinFont = nullptr,
@@ -225,12 +279,17 @@ protected:
                    SDL_Renderer* targetRenderer = nullptr);
     void renderButton(const SDL_Rect& rect, const std::string& text, 
                      bool hovered = false, SDL_Renderer* targetRenderer = nullptr);
+    // Drop-down list with its top-left corner at (x, y), e.g. completions
+    // under a text field; the `selected` entry is highlighted
+    void renderSuggestionList(int x, int y, const std::string_view* items, size_t count,
+                              size_t selected, SDL_Renderer* targetRenderer = nullptr);
     
     // ========================================================================
     // Scrollbar Management
     // ========================================================================
     void getScrollbarGeometry(int& sbX, int& sbY, int& sbHeight, 
                               int& thumbY, int& thumbHeight) const;
+    SDL_Rect getScrollbarRect() const;
     void renderScrollbar(SDL_Renderer* targetRenderer = nullptr);
     bool handleScrollbarClick(int x, int y);
     void handleScrollbarDrag(int y);
@@ -248,6 +307,16 @@ protected:
     bool showOverwriteConfirmDialog(const std::string& filename);
     bool showQuitConfirmDialog();
     
+    // ========================================================================
+    // Dirty Regions
+    // ========================================================================
+    // Marks part of the window for the next frame without a full repaint.
+    // render() checks isRegionDirty() to skip untouched parts and calls
+    // clearDirtyRegions() instead of SDL_RenderClear().
+    void markDirty(const SDL_Rect& rect);
+    bool isRegionDirty(const SDL_Rect& rect) const;
+    void clearDirtyRegions(SDL_Color color);
+    
     // ========================================================================
     // Utility Methods
     // ========================================================================
@@ -261,6 +330,14 @@ protected:
     virtual void onResize(int newWidth, int newHeight);
     virtual void update(float deltaTime);
     
+    // True while update() has to run every frame (momentum, transitions);
+    // otherwise the event loop sleeps until the next event
+    virtual bool isAnimating() const;
+    
+private:
+    void dispatchEvent(SDL_Event& event);
+    void renderFrame();
+    
 public:
     // ========================================================================
     // Public Interface
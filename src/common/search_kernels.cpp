@@ -0,0 +1,147 @@
+#include "search_kernels.h"
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SEARCH_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// ============================================================================
+// Scalar Kernel (portable fallback, also used for vector tails)
+// ============================================================================
+
+// The middle bytes of a candidate whose first and last bytes already match
+bool middleMatches(const uint8_t* candidate, const uint8_t* pattern, size_t length) {
+    return length <= 2 || std::memcmp(candidate + 1, pattern + 1, length - 2) == 0;
+}
+
+size_t findScalar(const uint8_t* data, size_t size, const uint8_t* pattern, size_t length) {
+    if (length == 0 || length > size) return SearchKernels::NOT_FOUND;
+
+    const uint8_t first = pattern[0];
+    const uint8_t last = pattern[length - 1];
+    const size_t lastStart = size - length;
+    size_t i = 0;
+
+    while (i <= lastStart) {
+        const void* hit = std::memchr(data + i, first, lastStart - i + 1);
+        if (!hit) break;
+        i = static_cast<size_t>(static_cast<const uint8_t*>(hit) - data);
+        if (data[i + length - 1] == last && middleMatches(data + i, pattern, length)) {
+            return i;
+        }
+        i++;
+    }
+    return SearchKernels::NOT_FOUND;
+}
+
+#ifdef SEARCH_KERNELS_X86
+
+// ============================================================================
+// SSE2 Kernel
+// ============================================================================
+
+// Bit k of the mask marks a candidate at i + k: data[i + k] equals the first
+// pattern byte and data[i + k + length - 1] equals the last one
+__attribute__((target("sse2")))
+size_t findSSE2(const uint8_t* data, size_t size, const uint8_t* pattern, size_t length) {
+    if (length == 0 || length > size) return SearchKernels::NOT_FOUND;
+
+    const __m128i first = _mm_set1_epi8(static_cast<char>(pattern[0]));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(pattern[length - 1]));
+    size_t i = 0;
+
+    for (; i + length - 1 + 16 <= size; i += 16) {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + length - 1));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last))));
+
+        while (mask != 0) {
+            size_t candidate = i + static_cast<size_t>(__builtin_ctz(mask));
+            if (middleMatches(data + candidate, pattern, length)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    size_t tail = findScalar(data + i, size - i, pattern, length);
+    return (tail == SearchKernels::NOT_FOUND) ? tail : i + tail;
+}
+
+// ============================================================================
+// AVX2 Kernel
+// ============================================================================
+
+__attribute__((target("avx2")))
+size_t findAVX2(const uint8_t* data, size_t size, const uint8_t* pattern, size_t length) {
+    if (length == 0 || length > size) return SearchKernels::NOT_FOUND;
+
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(pattern[0]));
+    const __m256i last = _mm256_set1_epi8(static_cast<char>(pattern[length - 1]));
+    size_t i = 0;
+
+    for (; i + length - 1 + 32 <= size; i += 32) {
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + length - 1));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last))));
+
+        while (mask != 0) {
+            size_t candidate = i + static_cast<size_t>(__builtin_ctz(mask));
+            if (middleMatches(data + candidate, pattern, length)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    size_t tail = findScalar(data + i, size - i, pattern, length);
+    return (tail == SearchKernels::NOT_FOUND) ? tail : i + tail;
+}
+
+#endif // SEARCH_KERNELS_X86
+
+// ============================================================================
+// Runtime Dispatch
+// ============================================================================
+
+struct KernelSet {
+    const char* name;
+    size_t (*find)(const uint8_t*, size_t, const uint8_t*, size_t);
+};
+
+KernelSet selectKernels() {
+#ifdef SEARCH_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {"avx2", findAVX2};
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return {"sse2", findSSE2};
+    }
+#endif
+    return {"scalar", findScalar};
+}
+
+// Resolved once; function-local statics are initialized thread-safely
+const KernelSet& kernels() {
+    static const KernelSet selected = selectKernels();
+    return selected;
+}
+
+} // namespace
+
+namespace SearchKernels {
+
+    size_t find(const uint8_t* data, size_t size, const uint8_t* pattern, size_t length) {
+        return kernels().find(data, size, pattern, length);
+    }
+
+    const char* activeKernelName() {
+        return kernels().name;
+    }
+}
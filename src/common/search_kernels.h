@@ -0,0 +1,24 @@
+#ifndef SEARCH_KERNELS_H
+#define SEARCH_KERNELS_H
+
+#include <cstdint>
+#include <cstddef>
+
+// Byte-pattern search behind the hex editor's search. Candidate positions are
+// found by comparing the pattern's first and last bytes against a whole
+// vector of positions at once; only positions where both agree are compared
+// in full. The widest kernel the CPU supports (AVX2, SSE2, or portable
+// scalar) is picked once on first use.
+namespace SearchKernels {
+
+    constexpr size_t NOT_FOUND = SIZE_MAX;
+
+    // Offset of the first occurrence of pattern[0..length) in data[0..size),
+    // or NOT_FOUND. An empty pattern is never found.
+    size_t find(const uint8_t* data, size_t size, const uint8_t* pattern, size_t length);
+
+    // Name of the kernel selected for this CPU ("avx2", "sse2" or "scalar")
+    const char* activeKernelName();
+}
+
+#endif // SEARCH_KERNELS_H
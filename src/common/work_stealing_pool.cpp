@@ -0,0 +1,123 @@
+#include "work_stealing_pool.h"
+
+// Identifies the pool/worker running on the current thread so tasks that
+// submit follow-up work push onto their own deque instead of a random one
+static thread_local const WorkStealingPool* currentPool = nullptr;
+static thread_local size_t currentWorkerIndex = 0;
+
+// ============================================================================
+// Constructor / Destructor
+// ============================================================================
+
+WorkStealingPool::WorkStealingPool(size_t threadCount)
+    : pendingTasks(0)
+    , nextQueue(0)
+    , stopping(false)
+    , queuedTasks(0) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) threadCount = 1;
+    }
+
+    for (size_t i = 0; i < threadCount; i++) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (size_t i = 0; i < threadCount; i++) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// ============================================================================
+// Submission
+// ============================================================================
+
+void WorkStealingPool::submit(Task task) {
+    size_t index;
+    if (currentPool == this) {
+        index = currentWorkerIndex;
+    } else {
+        index = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    }
+
+    pendingTasks.fetch_add(1, std::memory_order_acq_rel);
+    {
+        // Counted before the push so a sleeping worker can never miss it
+        std::lock_guard<std::mutex> lock(stateMutex);
+        queuedTasks++;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    workAvailable.notify_one();
+}
+
+void WorkStealingPool::wait() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return pendingTasks.load(std::memory_order_acquire) == 0; });
+}
+
+// ============================================================================
+// Worker Internals
+// ============================================================================
+
+bool WorkStealingPool::popLocal(size_t index, Task& task) {
+    WorkerQueue& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(size_t thiefIndex, Task& task) {
+    size_t count = queues.size();
+    for (size_t offset = 1; offset < count; offset++) {
+        WorkerQueue& victim = *queues[(thiefIndex + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.tasks.empty()) continue;
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentWorkerIndex = index;
+
+    while (true) {
+        Task task;
+        if (popLocal(index, task) || steal(index, task)) {
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                queuedTasks--;
+            }
+
+            task();
+
+            if (pendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                allDone.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(stateMutex);
+        workAvailable.wait(lock, [this] { return stopping || queuedTasks > 0; });
+        if (stopping && queuedTasks == 0) return;
+    }
+}
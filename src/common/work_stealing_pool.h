@@ -0,0 +1,63 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// Work-Stealing Thread Pool
+// ============================================================================
+// Each worker owns a deque: it pops its own work from the back (LIFO, cache
+// warm) and, when empty, steals from the front of the other workers' deques.
+// Tasks submitted from outside the pool are dealt round-robin across workers.
+
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    // threadCount == 0 uses one worker per hardware thread
+    explicit WorkStealingPool(size_t threadCount = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    void submit(Task task);
+
+    // Blocks until every submitted task (including ones submitted by tasks) has finished
+    void wait();
+
+    size_t size() const { return workers.size(); }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::atomic<size_t> pendingTasks;
+    std::atomic<size_t> nextQueue;
+    bool stopping;       // guarded by stateMutex
+    size_t queuedTasks;  // tasks sitting in some deque; guarded by stateMutex
+
+    // Sleeping workers and wait() callers park here
+    std::mutex stateMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+
+    bool popLocal(size_t index, Task& task);
+    bool steal(size_t thiefIndex, Task& task);
+    void workerLoop(size_t index);
+};
+
+#endif // WORK_STEALING_POOL_H
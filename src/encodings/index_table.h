@@ -0,0 +1,91 @@
+#ifndef INDEX_TABLE_H
+#define INDEX_TABLE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+// ============================================================================
+// ID-Keyed Constant Tables
+// ============================================================================
+// The species, move and item tables are constexpr arrays of entries with an
+// `id` member, sorted by id. They are defined once (C++17 inline variables),
+// live in read-only data and need no code at program start, unlike the hash
+// maps every including translation unit used to build before main().
+//
+// Lookups by id go through a DenseTable built from the sorted list at compile
+// time: one slot per id up to the largest one, plus a bitmap saying which
+// slots hold a real entry. The sorted lists stay for code that walks every
+// entry in order.
+
+namespace IndexTable {
+
+    template <typename Value, size_t Size>
+    struct DenseTable {
+        std::array<Value, Size> values{};
+        std::array<uint64_t, (Size + 63) / 64> valid{};
+
+        constexpr bool contains(uint32_t id) const {
+            return id < Size && ((valid[id >> 6] >> (id & 63)) & 1) != 0;
+        }
+
+        // nullptr when the id has no entry
+        constexpr const Value* find(uint32_t id) const {
+            return contains(id) ? &values[id] : nullptr;
+        }
+    };
+
+    template <typename Table>
+    constexpr bool isSortedById(const Table& table) {
+        auto it = std::begin(table);
+        auto end = std::end(table);
+        if (it == end) return true;
+        for (auto next = it + 1; next != end; ++it, ++next) {
+            if (!(it->id < next->id)) return false;
+        }
+        return true;
+    }
+
+    template <typename Table>
+    constexpr uint32_t maxId(const Table& table) {
+        uint32_t result = 0;
+        for (const auto& entry : table) {
+            if (entry.id > result) result = entry.id;
+        }
+        return result;
+    }
+
+    // Scatters a sorted table into a DenseTable of Size slots; `value` picks
+    // what each slot stores from an entry
+    template <size_t Size, typename Table, typename Projection>
+    constexpr auto makeDense(const Table& table, Projection value) {
+        using Value = decltype(value(*std::begin(table)));
+        DenseTable<Value, Size> result{};
+        for (const auto& entry : table) {
+            result.values[entry.id] = value(entry);
+            result.valid[entry.id >> 6] |= uint64_t{1} << (entry.id & 63);
+        }
+        return result;
+    }
+
+    // Joins two tables at compile time; both must be sorted and the second
+    // must start after the first ends
+    template <typename Entry, size_t N, size_t M>
+    constexpr std::array<Entry, N + M> concat(const Entry (&a)[N], const Entry (&b)[M]) {
+        std::array<Entry, N + M> result{};
+        for (size_t i = 0; i < N; i++) result[i] = a[i];
+        for (size_t i = 0; i < M; i++) result[N + i] = b[i];
+        return result;
+    }
+
+    template <typename Entry, size_t N, size_t M>
+    constexpr std::array<Entry, N + M> concat(const std::array<Entry, N>& a, const Entry (&b)[M]) {
+        std::array<Entry, N + M> result{};
+        for (size_t i = 0; i < N; i++) result[i] = a[i];
+        for (size_t i = 0; i < M; i++) result[N + i] = b[i];
+        return result;
+    }
+}
+
+#endif // INDEX_TABLE_H
@@ -2,7 +2,8 @@
 #define ITEMS_INDEX_ENG_H
 
 #include <cstdint>
-#include <unordered_map>
+#include "index_table.h"
+#include "name_index.h"
 
 namespace ItemsIndex {
 
@@ -28,6 +29,11 @@ struct Gen2ItemInfo {
     uint8_t pocket;
 };
 
+struct Gen2ItemEntry {
+    uint8_t id;
+    Gen2ItemInfo info;
+};
+
 // ============================================================================
 // Generation 3 Pocket Indices
 // ============================================================================
@@ -64,13 +70,23 @@ struct Gen3ItemInfo {
     uint8_t gameFlags;
 };
 
+struct Gen3ItemEntry {
+    uint16_t id;
+    Gen3ItemInfo info;
+};
+
+struct Gen1ItemEntry {
+    uint8_t id;
+    const char* name;
+};
+
 // ============================================================================
 // Generation 1 Items
 // ============================================================================
 
-// Sparse map - only valid items are included
+// Sparse table - only valid items are included
 // Invalid items (gaps in the index) are not represented
-static const std::unordered_map<uint8_t, const char*> GEN1_ITEMS = {
+inline constexpr Gen1ItemEntry GEN1_ITEMS[] = {
     {0x01, "Master Ball"},
     {0x02, "Ultra Ball"},
     {0x03, "Great Ball"},
@@ -222,7 +238,7 @@ static const std::unordered_map<uint8_t, const char*> GEN1_ITEMS = {
 
 // Full item list for Generation 2
 // Items with nameCrystal != nullptr are Crystal-exclusive (Teru-sama in GS)
-static const std::unordered_map<uint8_t, Gen2ItemInfo> GEN2_ITEMS = {
+inline constexpr Gen2ItemEntry GEN2_ITEMS[] = {
     {0x00, {"None", nullptr, POCKET_ITEMS}},
     {0x01, {"Master Ball", nullptr, POCKET_BALLS}},
     {0x02, {"Ultra Ball", nullptr, POCKET_BALLS}},
@@ -485,8 +501,8 @@ static const std::unordered_map<uint8_t, Gen2ItemInfo> GEN2_ITEMS = {
 
 // Note: Gen 3 uses 16-bit item indices
 // Items marked with gameFlags indicate which games they appear in
-// Unknown/unused item slots are not included in this map
-static const std::unordered_map<uint16_t, Gen3ItemInfo> GEN3_ITEMS = {
+// Unknown/unused item slots are not included in this table
+inline constexpr Gen3ItemEntry GEN3_ITEMS[] = {
     // Nothing
     {0x0000, {"Nothing", GEN3_POCKET_UNKNOWN, GEN3_GAME_ALL}},
     
@@ -832,26 +848,43 @@ static const std::unordered_map<uint16_t, Gen3ItemInfo> GEN3_ITEMS = {
     {0x0178, {"Old Sea Map", GEN3_POCKET_KEY_ITEMS, GEN3_GAME_E}}
 };
 
+static_assert(IndexTable::isSortedById(GEN1_ITEMS), "GEN1_ITEMS must be sorted by index");
+static_assert(IndexTable::isSortedById(GEN2_ITEMS), "GEN2_ITEMS must be sorted by index");
+static_assert(IndexTable::isSortedById(GEN3_ITEMS), "GEN3_ITEMS must be sorted by index");
+
+inline constexpr auto GEN1_ITEMS_BY_ID = IndexTable::makeDense<IndexTable::maxId(GEN1_ITEMS) + 1>(
+    GEN1_ITEMS, [](const Gen1ItemEntry& entry) { return entry.name; });
+inline constexpr auto GEN2_ITEMS_BY_ID = IndexTable::makeDense<IndexTable::maxId(GEN2_ITEMS) + 1>(
+    GEN2_ITEMS, [](const Gen2ItemEntry& entry) { return entry.info; });
+inline constexpr auto GEN3_ITEMS_BY_ID = IndexTable::makeDense<IndexTable::maxId(GEN3_ITEMS) + 1>(
+    GEN3_ITEMS, [](const Gen3ItemEntry& entry) { return entry.info; });
+
+// Case-insensitive name indexes for lookup and autocompletion by name. Gen 2
+// has one per name set, since Crystal renamed a few items.
+inline constexpr auto GEN1_ITEM_NAMES = NameIndex::build(
+    GEN1_ITEMS, [](const Gen1ItemEntry& entry) { return std::string_view(entry.name); });
+inline constexpr auto GEN2_ITEM_NAMES_GS = NameIndex::build(
+    GEN2_ITEMS, [](const Gen2ItemEntry& entry) { return std::string_view(entry.info.nameGS); });
+inline constexpr auto GEN2_ITEM_NAMES_CRYSTAL = NameIndex::build(
+    GEN2_ITEMS, [](const Gen2ItemEntry& entry) {
+        return std::string_view(entry.info.nameCrystal ? entry.info.nameCrystal : entry.info.nameGS);
+    });
+inline constexpr auto GEN3_ITEM_NAMES = NameIndex::build(
+    GEN3_ITEMS, [](const Gen3ItemEntry& entry) { return std::string_view(entry.info.name); });
+
 // ============================================================================
 // Generation 1 and 2 Utility Functions
 // ============================================================================
 
 // Get Gen 1 item name by index (returns nullptr if not found)
 inline const char* getGen1ItemName(uint8_t index) {
-    auto it = GEN1_ITEMS.find(index);
-    if (it != GEN1_ITEMS.end()) {
-        return it->second;
-    }
-    return nullptr;
+    const char* const* name = GEN1_ITEMS_BY_ID.find(index);
+    return name ? *name : nullptr;
 }
 
 // Get Gen 2 item info by index (returns nullptr if not found)
 inline const Gen2ItemInfo* getGen2ItemInfo(uint8_t index) {
-    auto it = GEN2_ITEMS.find(index);
-    if (it != GEN2_ITEMS.end()) {
-        return &it->second;
-    }
-    return nullptr;
+    return GEN2_ITEMS_BY_ID.find(index);
 }
 
 // Get Gen 2 item name by index for specific game version
@@ -886,12 +919,12 @@ inline uint8_t getGen2ItemPocket(uint8_t index) {
 
 // Check if Gen 2 item exists in given index
 inline bool gen2ItemExists(uint8_t index) {
-    return GEN2_ITEMS.find(index) != GEN2_ITEMS.end();
+    return GEN2_ITEMS_BY_ID.contains(index);
 }
 
 // Check if Gen 1 item exists in given index
 inline bool gen1ItemExists(uint8_t index) {
-    return GEN1_ITEMS.find(index) != GEN1_ITEMS.end();
+    return GEN1_ITEMS_BY_ID.contains(index);
 }
 
 // ============================================================================
@@ -900,11 +933,7 @@ inline bool gen1ItemExists(uint8_t index) {
 
 // Get Gen 3 item info by index (returns nullptr if not found)
 inline const Gen3ItemInfo* getGen3ItemInfo(uint16_t index) {
-    auto it = GEN3_ITEMS.find(index);
-    if (it != GEN3_ITEMS.end()) {
-        return &it->second;
-    }
-    return nullptr;
+    return GEN3_ITEMS_BY_ID.find(index);
 }
 
 // Get Gen 3 item name by index (returns nullptr if not found)
@@ -930,7 +959,7 @@ inline uint8_t getGen3ItemGameFlags(uint16_t index) {
 
 // Check if Gen 3 item exists in given index
 inline bool gen3ItemExists(uint16_t index) {
-    return GEN3_ITEMS.find(index) != GEN3_ITEMS.end();
+    return GEN3_ITEMS_BY_ID.contains(index);
 }
 
 // Check if Gen 3 item is available in a specific game
@@ -2,11 +2,17 @@
 #define MOVES_INDEX_ENG_H
 
 #include <cstdint>
-#include <unordered_map>
+#include "index_table.h"
+#include "name_index.h"
 
 namespace PokemonMoves {
 
-static const std::unordered_map<uint8_t, const char*> GEN1_MOVES = {
+struct MoveEntry {
+    uint16_t id;
+    const char* name;
+};
+
+inline constexpr MoveEntry GEN1_MOVES[] = {
     {0x00, "-"},
     {0x01, "Pound"},
     {0x02, "Karate Chop"},
@@ -175,17 +181,8 @@ static const std::unordered_map<uint8_t, const char*> GEN1_MOVES = {
     {0xA5, "Struggle"},
 };
 
-// Helper function to build combined generation maps
-static std::unordered_map<uint8_t, const char*> buildGenerationMap(
-    const std::unordered_map<uint8_t, const char*>& prevGen,
-    const std::unordered_map<uint8_t, const char*>& newMoves) {
-    std::unordered_map<uint8_t, const char*> combined = prevGen;
-    combined.insert(newMoves.begin(), newMoves.end());
-    return combined;
-}
-
 // New moves introduced in Generation 2
-static const std::unordered_map<uint8_t, const char*> GEN2_NEW_MOVES = {
+inline constexpr MoveEntry GEN2_NEW_MOVES[] = {
     {0xA6, "Sketch"},
     {0xA7, "Triple Kick"},
     {0xA8, "Thief"},
@@ -275,7 +272,7 @@ static const std::unordered_map<uint8_t, const char*> GEN2_NEW_MOVES = {
 };
 
 // New moves introduced in Generation 3
-static const std::unordered_map<uint16_t, const char*> GEN3_NEW_MOVES = {
+inline constexpr MoveEntry GEN3_NEW_MOVES[] = {
     {0xFC, "Fake Out"},
     {0xFD, "Uproar"},
     {0xFE, "Stockpile"},
@@ -381,50 +378,42 @@ static const std::unordered_map<uint16_t, const char*> GEN3_NEW_MOVES = {
     {0x162, "Psycho Boost"},
 };
 
-// Combined maps
-static const std::unordered_map<uint8_t, const char*> GEN2_MOVES = buildGenerationMap(GEN1_MOVES, GEN2_NEW_MOVES);
+// Combined tables; each generation's new moves follow the previous ones
+inline constexpr auto GEN2_MOVES = IndexTable::concat(GEN1_MOVES, GEN2_NEW_MOVES);
+inline constexpr auto GEN3_MOVES = IndexTable::concat(GEN2_MOVES, GEN3_NEW_MOVES);
 
-// Build GEN3_MOVES from GEN2_MOVES + GEN3_NEW_MOVES
-// Note: GEN3_MOVES needs to handle 16-bit indices
-static std::unordered_map<uint16_t, const char*> buildGen3Moves() {
-    std::unordered_map<uint16_t, const char*> gen3;
-    
-    // Copy all Gen1 and Gen2 moves
-    for (const auto& [key, value] : GEN2_MOVES) {
-        gen3[key] = value;
-    }
-    
-    // Add Gen3 new moves
-    gen3.insert(GEN3_NEW_MOVES.begin(), GEN3_NEW_MOVES.end());
-    
-    return gen3;
-}
+static_assert(IndexTable::isSortedById(GEN3_MOVES), 
+              "move tables must be sorted and each generation must follow the last");
+
+// Names by move id; GEN3_MOVES is a superset of the earlier generations, so
+// the Gen 1 and Gen 2 accessors check the id range against it
+inline constexpr auto MOVE_NAMES_BY_ID = IndexTable::makeDense<IndexTable::maxId(GEN3_MOVES) + 1>(
+    GEN3_MOVES, [](const MoveEntry& entry) { return entry.name; });
+inline constexpr uint16_t GEN1_MOVE_COUNT = IndexTable::maxId(GEN1_MOVES) + 1;
+inline constexpr uint16_t GEN2_MOVE_COUNT = IndexTable::maxId(GEN2_MOVES) + 1;
 
-static const std::unordered_map<uint16_t, const char*> GEN3_MOVES = buildGen3Moves();
+// Case-insensitive name indexes for lookup and autocompletion by name
+inline constexpr auto GEN1_MOVE_NAMES = NameIndex::build(
+    GEN1_MOVES, [](const MoveEntry& entry) { return std::string_view(entry.name); });
+inline constexpr auto GEN2_MOVE_NAMES = NameIndex::build(
+    GEN2_MOVES, [](const MoveEntry& entry) { return std::string_view(entry.name); });
 
 // Helper functions
 inline const char* getGen1MoveName(uint8_t move) {
-    auto it = GEN1_MOVES.find(move);
-    if (it != GEN1_MOVES.end()) {
-        return it->second;
-    }
-    return nullptr;
+    if (move >= GEN1_MOVE_COUNT) return nullptr;
+    const char* const* name = MOVE_NAMES_BY_ID.find(move);
+    return name ? *name : nullptr;
 }
 
 inline const char* getGen2MoveName(uint8_t move) {
-    auto it = GEN2_MOVES.find(move);
-    if (it != GEN2_MOVES.end()) {
-        return it->second;
-    }
-    return nullptr;
+    if (move >= GEN2_MOVE_COUNT) return nullptr;
+    const char* const* name = MOVE_NAMES_BY_ID.find(move);
+    return name ? *name : nullptr;
 }
 
 inline const char* getGen3MoveName(uint16_t move) {
-    auto it = GEN3_MOVES.find(move);
-    if (it != GEN3_MOVES.end()) {
-        return it->second;
-    }
-    return nullptr;
+    const char* const* name = MOVE_NAMES_BY_ID.find(move);
+    return name ? *name : nullptr;
 }
 
 // Generic function that can handle any generation
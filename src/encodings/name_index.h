@@ -0,0 +1,217 @@
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+// ============================================================================
+// Name Indexes
+// ============================================================================
+// Species, move and item names sorted case-insensitively at compile time, so
+// typed names resolve by binary search instead of upper-casing every table
+// entry per lookup. Entries with the same name keep id order, which makes the
+// first match the lowest id, as the old linear scans returned.
+//
+// Besides exact lookup an index answers prefix queries (the sorted order
+// keeps every name sharing a prefix in one run) and fuzzy queries bounded by
+// edit distance, which together drive the editors' autocompletion.
+
+namespace NameIndex {
+
+    struct Entry {
+        std::string_view name;
+        uint16_t id;
+    };
+
+    // A whole index or a run of one; the queries take either
+    struct Range {
+        const Entry* first = nullptr;
+        const Entry* last = nullptr;
+
+        Range() = default;
+        Range(const Entry* first, const Entry* last) : first(first), last(last) {}
+        template <size_t N>
+        Range(const std::array<Entry, N>& index) : first(index.data()), last(index.data() + N) {}
+
+        bool empty() const { return first == last; }
+        const Entry* begin() const { return first; }
+        const Entry* end() const { return last; }
+    };
+
+    constexpr char fold(char c) {
+        return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+    }
+
+    // <0, 0 or >0 like strcmp, ignoring ASCII case
+    constexpr int compareFolded(std::string_view a, std::string_view b) {
+        size_t length = (a.size() < b.size()) ? a.size() : b.size();
+        for (size_t i = 0; i < length; i++) {
+            char ca = fold(a[i]);
+            char cb = fold(b[i]);
+            if (ca != cb) {
+                return (static_cast<unsigned char>(ca) < static_cast<unsigned char>(cb)) ? -1 : 1;
+            }
+        }
+        if (a.size() == b.size()) return 0;
+        return (a.size() < b.size()) ? -1 : 1;
+    }
+
+    inline bool startsWithFolded(std::string_view name, std::string_view prefix) {
+        return name.size() >= prefix.size() &&
+               compareFolded(name.substr(0, prefix.size()), prefix) == 0;
+    }
+
+    // Builds an index from any id-keyed table; `name` picks the name of an
+    // entry. Insertion sort, because std::sort isn't constexpr in C++17; it
+    // is stable, so equal names stay in the table's id order.
+    template <size_t N, typename Iterator, typename Projection>
+    constexpr std::array<Entry, N> build(Iterator table, Projection name) {
+        std::array<Entry, N> result{};
+        for (size_t i = 0; i < N; i++) {
+            Entry entry{name(table[i]), static_cast<uint16_t>(table[i].id)};
+            size_t j = i;
+            while (j > 0 && compareFolded(entry.name, result[j - 1].name) < 0) {
+                result[j] = result[j - 1];
+                j--;
+            }
+            result[j] = entry;
+        }
+        return result;
+    }
+
+    template <typename Value, size_t N, typename Projection>
+    constexpr std::array<Entry, N> build(const Value (&table)[N], Projection name) {
+        return build<N>(std::begin(table), name);
+    }
+
+    template <typename Value, size_t N, typename Projection>
+    constexpr std::array<Entry, N> build(const std::array<Value, N>& table, Projection name) {
+        return build<N>(table.begin(), name);
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    // All entries whose name equals `name`, ignoring case
+    inline Range findAll(Range index, std::string_view name) {
+        auto range = std::equal_range(index.begin(), index.end(), Entry{name, 0},
+                                      [](const Entry& a, const Entry& b) {
+                                          return compareFolded(a.name, b.name) < 0;
+                                      });
+        return {range.first, range.second};
+    }
+
+    // Lowest-id entry named `name`, or nullptr
+    inline const Entry* find(Range index, std::string_view name) {
+        Range range = findAll(index, name);
+        return range.empty() ? nullptr : range.first;
+    }
+
+    // All entries whose name starts with `prefix`, in name order
+    inline Range findPrefix(Range index, std::string_view prefix) {
+        auto first = std::lower_bound(index.begin(), index.end(), prefix,
+                                      [](const Entry& entry, std::string_view key) {
+                                          return compareFolded(entry.name.substr(0, key.size()), key) < 0;
+                                      });
+        auto last = std::upper_bound(first, index.end(), prefix,
+                                     [](std::string_view key, const Entry& entry) {
+                                         return compareFolded(key, entry.name.substr(0, key.size())) < 0;
+                                     });
+        return {first, last};
+    }
+
+    // Edit distance, ignoring case, from `query` to the closest prefix of
+    // `name`, so a partly typed name with a typo still finds its entry.
+    // Swapping two neighbouring letters counts as one edit. Gives up once
+    // the distance must exceed maxDistance and returns maxDistance + 1 then.
+    inline size_t prefixDistance(std::string_view query, std::string_view name, size_t maxDistance) {
+        constexpr size_t MAX_LENGTH = 63;
+        name = name.substr(0, query.size() + maxDistance);
+        if (query.size() > name.size() + maxDistance || name.size() > MAX_LENGTH) {
+            return maxDistance + 1;
+        }
+
+        // Rows i-2, i-1 and i of the distance matrix
+        std::array<size_t, MAX_LENGTH + 1> rows[3];
+        size_t* twoBack = rows[0].data();
+        size_t* previous = rows[1].data();
+        size_t* current = rows[2].data();
+        for (size_t j = 0; j <= name.size(); j++) previous[j] = j;
+
+        for (size_t i = 1; i <= query.size(); i++) {
+            char q = fold(query[i - 1]);
+            current[0] = i;
+            size_t rowMin = i;
+            for (size_t j = 1; j <= name.size(); j++) {
+                char n = fold(name[j - 1]);
+                size_t cost = (q == n) ? 0 : 1;
+                size_t best = std::min({previous[j] + 1, current[j - 1] + 1, previous[j - 1] + cost});
+                if (i > 1 && j > 1 && q == fold(name[j - 2]) && fold(query[i - 2]) == n) {
+                    best = std::min(best, twoBack[j - 2] + 1);
+                }
+                current[j] = best;
+                rowMin = std::min(rowMin, best);
+            }
+            // Later rows can't drop below this one's minimum
+            if (rowMin > maxDistance) return maxDistance + 1;
+
+            std::swap(twoBack, previous);
+            std::swap(previous, current);
+        }
+
+        size_t best = *std::min_element(previous, previous + name.size() + 1);
+        return std::min(best, maxDistance + 1);
+    }
+
+    // Fills `out` with up to maxResults suggestions for a partly typed name:
+    // names starting with the query first, then names whose beginning is
+    // within a small edit distance of it, nearest first. Each name is
+    // suggested once, and only entries `accept` allows are considered.
+    // Returns the number written.
+    template <typename Accept>
+    size_t suggest(Range index, std::string_view query,
+                   Entry* out, size_t maxResults, Accept accept) {
+        size_t count = 0;
+        if (query.empty() || maxResults == 0) return 0;
+
+        auto alreadySuggested = [&](const Entry& entry) {
+            for (size_t i = 0; i < count; i++) {
+                if (compareFolded(out[i].name, entry.name) == 0) return true;
+            }
+            return false;
+        };
+
+        for (const Entry& entry : findPrefix(index, query)) {
+            if (count == maxResults) return count;
+            if (accept(entry) && !alreadySuggested(entry)) {
+                out[count++] = entry;
+            }
+        }
+
+        // Short queries match too much to allow typos; longer ones allow one,
+        // and two from eight characters on
+        size_t maxDistance = (query.size() < 4) ? 0 : (query.size() < 8) ? 1 : 2;
+        for (size_t distance = 1; distance <= maxDistance; distance++) {
+            for (const Entry& entry : index) {
+                if (count == maxResults) return count;
+                if (startsWithFolded(entry.name, query)) continue;
+                if (prefixDistance(query, entry.name, distance) != distance) continue;
+                if (accept(entry) && !alreadySuggested(entry)) {
+                    out[count++] = entry;
+                }
+            }
+        }
+        return count;
+    }
+
+    inline size_t suggest(Range index, std::string_view query, Entry* out, size_t maxResults) {
+        return suggest(index, query, out, maxResults, [](const Entry&) { return true; });
+    }
+}
+
+#endif // NAME_INDEX_H
@@ -2,7 +2,8 @@
 #define POKEMON_INDEX_ENG_H
 
 #include <cstdint>
-#include <unordered_map>
+#include "index_table.h"
+#include "name_index.h"
 
 namespace PokemonIndex {
 
@@ -43,11 +44,16 @@ struct PokemonInfo {
     uint8_t type2;
 };
 
+struct PokemonEntry {
+    uint8_t id;
+    PokemonInfo info;
+};
+
 // ============================================================================
 // Generation 1 Pokémon Table
 // ============================================================================
 
-static const std::unordered_map<uint8_t, PokemonInfo> GEN1_POKEMON = {
+inline constexpr PokemonEntry GEN1_POKEMON[] = {
     {0x01, {"Rhydon", TYPE_GROUND, TYPE_ROCK}},
     {0x02, {"Kangaskhan", TYPE_NORMAL, TYPE_NORMAL}},
     {0x03, {"Nidoran♂", TYPE_POISON, TYPE_POISON}},
@@ -244,7 +250,7 @@ static const std::unordered_map<uint8_t, PokemonInfo> GEN1_POKEMON = {
 // Generation 2 Pokémon Table
 // ============================================================================
 
-static const std::unordered_map<uint8_t, PokemonInfo> GEN2_POKEMON = {
+inline constexpr PokemonEntry GEN2_POKEMON[] = {
     {0x00, {"?????", TYPE_STEEL, TYPE_UNKNOWN}},
     {0x01, {"Bulbasaur", TYPE_GRASS, TYPE_POISON}},
     {0x02, {"Ivysaur", TYPE_GRASS, TYPE_POISON}},
@@ -503,30 +509,34 @@ static const std::unordered_map<uint8_t, PokemonInfo> GEN2_POKEMON = {
     {0xFF, {"?????", TYPE_NORMAL, TYPE_NORMAL}},
 };
 
+static_assert(IndexTable::isSortedById(GEN1_POKEMON), "GEN1_POKEMON must be sorted by index");
+static_assert(IndexTable::isSortedById(GEN2_POKEMON), "GEN2_POKEMON must be sorted by index");
+
+inline constexpr auto GEN1_POKEMON_BY_ID = IndexTable::makeDense<IndexTable::maxId(GEN1_POKEMON) + 1>(
+    GEN1_POKEMON, [](const PokemonEntry& entry) { return entry.info; });
+inline constexpr auto GEN2_POKEMON_BY_ID = IndexTable::makeDense<IndexTable::maxId(GEN2_POKEMON) + 1>(
+    GEN2_POKEMON, [](const PokemonEntry& entry) { return entry.info; });
+
+// Case-insensitive name indexes for lookup and autocompletion by name
+inline constexpr auto GEN1_POKEMON_NAMES = NameIndex::build(
+    GEN1_POKEMON, [](const PokemonEntry& entry) { return std::string_view(entry.info.name); });
+inline constexpr auto GEN2_POKEMON_NAMES = NameIndex::build(
+    GEN2_POKEMON, [](const PokemonEntry& entry) { return std::string_view(entry.info.name); });
+
 // ============================================================================
 // Utility functions
 // ============================================================================
 
 // Get Pokémon info by index and generation (returns nullptr if not found)
 inline const PokemonInfo* getPokemonInfo(uint8_t index, int generation) {
-    const std::unordered_map<uint8_t, PokemonInfo>* pokemonMap = nullptr;
-    
     switch (generation) {
         case 1:
-            pokemonMap = &GEN1_POKEMON;
-            break;
+            return GEN1_POKEMON_BY_ID.find(index);
         case 2:
-            pokemonMap = &GEN2_POKEMON;
-            break;
+            return GEN2_POKEMON_BY_ID.find(index);
         default:
             return nullptr;
     }
-    
-    auto it = pokemonMap->find(index);
-    if (it != pokemonMap->end()) {
-        return &it->second;
-    }
-    return nullptr;
 }
 
 // Get Pokémon name by index and generation (returns nullptr if not found)
@@ -1,8 +1,10 @@
 #ifndef TEXT_ENCODINGS_H
 #define TEXT_ENCODINGS_H
 
+#include <array>
+#include <cstdint>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
 enum class TextEncoding {
@@ -25,7 +27,7 @@ inline TextEncoding parseEncodingArg(const std::string& arg) {
     return TextEncoding::ASCII;
 }
 
-inline std::string getEncodingName(TextEncoding enc) {
+inline std::string_view getEncodingNameView(TextEncoding enc) {
     switch (enc) {
         case TextEncoding::EN_G1: return "English Gen 1";
         case TextEncoding::EN_G2: return "English Gen 2";
@@ -37,14 +39,26 @@ inline std::string getEncodingName(TextEncoding enc) {
     }
 }
 
+inline std::string getEncodingName(TextEncoding enc) {
+    return std::string(getEncodingNameView(enc));
+}
+
 // ============================================================================
 // Common encoding tables
 // ============================================================================
 
 namespace EncodingTables {
 
+// Byte-to-text pairs in source order. A byte listed twice keeps its first
+// text. When several bytes share a text, encoding uses the first one listed
+// that isn't 0x00, unless ENCODE_OVERRIDES names another.
+struct Entry {
+    unsigned char byte;
+    std::string_view text;
+};
+
 // English Generation 1
-static const std::unordered_map<unsigned char, std::string> EN_G1_TABLE = {
+inline constexpr Entry EN_G1_ENTRIES[] = {
     // Space
     {0x7F, " "},
     
@@ -94,7 +108,7 @@ static const std::unordered_map<unsigned char, std::string> EN_G1_TABLE = {
 };
 
 // English Generation 2
-static const std::unordered_map<unsigned char, std::string> EN_G2_TABLE = {
+inline constexpr Entry EN_G2_ENTRIES[] = {
     // Space
     {0x7F, " "},
     
@@ -135,7 +149,7 @@ static const std::unordered_map<unsigned char, std::string> EN_G2_TABLE = {
 };
 
 // English Generation 3
-static const std::unordered_map<unsigned char, std::string> EN_G3_TABLE = {
+inline constexpr Entry EN_G3_ENTRIES[] = {
     // Space
     {0x00, " "},
 
@@ -186,7 +200,7 @@ static const std::unordered_map<unsigned char, std::string> EN_G3_TABLE = {
 };
 
 // Japanese Generation 1
-static const std::unordered_map<unsigned char, std::string> JP_G1_TABLE = {
+inline constexpr Entry JP_G1_ENTRIES[] = {
     // Row 0- (dakuten variants)
     {0x01, "イ゙"}, {0x02, "ヴ"}, {0x03, "エ゙"}, {0x04, "オ゙"},
     {0x05, "ガ"}, {0x06, "ギ"}, {0x07, "グ"}, {0x08, "ゲ"}, {0x09, "ゴ"},
@@ -268,7 +282,7 @@ static const std::unordered_map<unsigned char, std::string> JP_G1_TABLE = {
 };
 
 // Japanese Generation 2
-static const std::unordered_map<unsigned char, std::string> JP_G2_TABLE = {
+inline constexpr Entry JP_G2_ENTRIES[] = {
     // Row 0-
     {0x00, "?"}, {0x01, "イ゙"}, {0x02, "ヴ"}, {0x03, "エ゙"}, {0x04, "オ゙"},
     {0x05, "ガ"}, {0x06, "ギ"}, {0x07, "グ"}, {0x08, "ゲ"}, {0x09, "ゴ"},
@@ -348,7 +362,7 @@ static const std::unordered_map<unsigned char, std::string> JP_G2_TABLE = {
 };
 
 // Japanese Generation 3
-static const std::unordered_map<unsigned char, std::string> JP_G3_TABLE = {
+inline constexpr Entry JP_G3_ENTRIES[] = {
     // 0x0- row (hiragana)
     {0x00, "あ"}, {0x01, "い"}, {0x02, "う"}, {0x03, "え"}, {0x04, "お"},
     {0x05, "か"}, {0x06, "き"}, {0x07, "く"}, {0x08, "け"}, {0x09, "こ"},
@@ -443,22 +457,141 @@ static const std::unordered_map<unsigned char, std::string> JP_G3_TABLE = {
     {0xF4, "ä"}, {0xF5, "ö"}, {0xF6, "ü"},
 };
 
-// Get the appropriate table for an encoding
-inline const std::unordered_map<unsigned char, std::string>& getTable(TextEncoding encoding) {
-    switch (encoding) {
-        case TextEncoding::EN_G1: return EN_G1_TABLE;
-        case TextEncoding::EN_G2: return EN_G2_TABLE;
-        case TextEncoding::EN_G3: return EN_G3_TABLE;
-        case TextEncoding::JP_G1: return JP_G1_TABLE;
-        case TextEncoding::JP_G2: return JP_G2_TABLE;
-        case TextEncoding::JP_G3: return JP_G3_TABLE;
-        default: {
-            static const std::unordered_map<unsigned char, std::string> empty;
-            return empty;
-        }
+// ============================================================================
+// Dense decode tables
+// ============================================================================
+// One slot per byte value, built at compile time from the lists above.
+// Decoding is a plain array lookup that doesn't hash, allocate or run
+// static initializers, so any thread can read the tables.
+
+struct DecodedChar {
+    std::string_view text;      // empty for control characters
+    uint8_t cells = 0;          // fixed-width cells the text occupies
+    bool japanese = false;      // multi-byte UTF-8, drawn with the Japanese font
+};
+
+using DecodeTable = std::array<DecodedChar, 256>;
+
+constexpr size_t utf8CharLength(unsigned char firstByte) {
+    if ((firstByte & 0x80) == 0) return 1;
+    if ((firstByte & 0xE0) == 0xC0) return 2;
+    if ((firstByte & 0xF0) == 0xE0) return 3;
+    if ((firstByte & 0xF8) == 0xF0) return 4;
+    return 1;
+}
+
+// Combining (han)dakuten U+3099/U+309A: E3 82 99 and E3 82 9A
+constexpr bool isCombiningDakuten(std::string_view text, size_t pos) {
+    return pos + 2 < text.size() &&
+           static_cast<unsigned char>(text[pos]) == 0xE3 &&
+           static_cast<unsigned char>(text[pos + 1]) == 0x82 &&
+           (static_cast<unsigned char>(text[pos + 2]) == 0x99 ||
+            static_cast<unsigned char>(text[pos + 2]) == 0x9A);
+}
+
+// A combining mark shares the cell of the character before it, unless
+// that is a space or a dot
+constexpr uint8_t countCells(std::string_view text) {
+    uint8_t cells = 0;
+    size_t previous = 0;
+    for (size_t pos = 0; pos < text.size();) {
+        bool combining = pos > 0 && isCombiningDakuten(text, pos) &&
+                         text[previous] != ' ' && text[previous] != '.';
+        if (!combining) cells++;
+        previous = pos;
+        pos += utf8CharLength(static_cast<unsigned char>(text[pos]));
+    }
+    return cells;
+}
+
+constexpr bool isMultiByte(std::string_view text) {
+    for (char c : text) {
+        if (static_cast<unsigned char>(c) >= 0x80) return true;
+    }
+    return false;
+}
+
+template <size_t N>
+constexpr DecodeTable buildDecodeTable(const Entry (&entries)[N]) {
+    DecodeTable table{};
+    for (size_t i = 0; i < N; i++) {
+        DecodedChar& slot = table[entries[i].byte];
+        if (!slot.text.empty()) continue;
+        slot = DecodedChar{entries[i].text, countCells(entries[i].text), 
+                           isMultiByte(entries[i].text)};
+    }
+    return table;
+}
+
+inline constexpr char ASCII_PRINTABLE[] = 
+    " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+
+constexpr DecodeTable buildAsciiTable() {
+    DecodeTable table{};
+    for (size_t byte = 32; byte < 127; byte++) {
+        table[byte] = DecodedChar{std::string_view(ASCII_PRINTABLE + (byte - 32), 1), 1, false};
     }
+    return table;
+}
+
+inline constexpr DecodeTable ASCII_DECODE = buildAsciiTable();
+inline constexpr DecodeTable EN_G1_DECODE = buildDecodeTable(EN_G1_ENTRIES);
+inline constexpr DecodeTable EN_G2_DECODE = buildDecodeTable(EN_G2_ENTRIES);
+inline constexpr DecodeTable EN_G3_DECODE = buildDecodeTable(EN_G3_ENTRIES);
+inline constexpr DecodeTable JP_G1_DECODE = buildDecodeTable(JP_G1_ENTRIES);
+inline constexpr DecodeTable JP_G2_DECODE = buildDecodeTable(JP_G2_ENTRIES);
+inline constexpr DecodeTable JP_G3_DECODE = buildDecodeTable(JP_G3_ENTRIES);
+
+// Indexed by TextEncoding, in enum order
+inline constexpr const DecodeTable* DECODE_TABLES[] = {
+    &ASCII_DECODE, &EN_G1_DECODE, &EN_G2_DECODE, &JP_G1_DECODE, 
+    &JP_G2_DECODE, &EN_G3_DECODE, &JP_G3_DECODE
+};
+
+static_assert(sizeof(DECODE_TABLES) / sizeof(DECODE_TABLES[0]) == 
+              static_cast<size_t>(TextEncoding::JP_G3) + 1,
+              "DECODE_TABLES must have one table per TextEncoding");
+static_assert(ASCII_DECODE['A'].text == "A" && ASCII_DECODE['~'].text == "~",
+              "ASCII_PRINTABLE must start at 0x20");
+
+constexpr const DecodeTable& getTable(TextEncoding encoding) {
+    return *DECODE_TABLES[static_cast<size_t>(encoding)];
+}
+
+// Source-order entries for encoding; empty for ASCII
+struct EntryList {
+    const Entry* entries;
+    size_t count;
+};
+
+template <size_t N>
+constexpr EntryList entryList(const Entry (&entries)[N]) {
+    return EntryList{entries, N};
+}
+
+inline constexpr EntryList ENTRY_LISTS[] = {
+    {nullptr, 0}, entryList(EN_G1_ENTRIES), entryList(EN_G2_ENTRIES), entryList(JP_G1_ENTRIES),
+    entryList(JP_G2_ENTRIES), entryList(EN_G3_ENTRIES), entryList(JP_G3_ENTRIES)
+};
+
+constexpr EntryList getEntries(TextEncoding encoding) {
+    return ENTRY_LISTS[static_cast<size_t>(encoding)];
 }
 
+// Shared texts that encode to a byte other than the first one listed, as
+// they always have; saves written by earlier versions depend on these
+struct EncodeOverride {
+    TextEncoding encoding;
+    std::string_view text;
+    unsigned char byte;
+};
+
+inline constexpr EncodeOverride ENCODE_OVERRIDES[] = {
+    {TextEncoding::EN_G1, "'", 0xE0},
+    {TextEncoding::EN_G2, ".", 0xF2},
+    {TextEncoding::EN_G3, ".", 0xB0},
+};
+
 } // namespace EncodingTables
 
 // ============================================================================
@@ -466,21 +599,18 @@ inline const std::unordered_map<unsigned char, std::string>& getTable(TextEncodi
 // ============================================================================
 
 // Decode a single byte
+inline const EncodingTables::DecodedChar& decodeChar(unsigned char byte, TextEncoding encoding) {
+    return EncodingTables::getTable(encoding)[byte];
+}
+
+// Empty for control characters. The view points into the static tables
+// and stays valid for the life of the program.
+inline std::string_view decodeByteView(unsigned char byte, TextEncoding encoding) {
+    return EncodingTables::getTable(encoding)[byte].text;
+}
+
 inline std::string decodeByte(unsigned char byte, TextEncoding encoding) {
-    if (encoding == TextEncoding::ASCII) {
-        // Standard ASCII
-        if (byte >= 32 && byte < 127) {
-            return std::string(1, (char)byte);
-        }
-        return "";
-    }
-    
-    const auto& table = EncodingTables::getTable(encoding);
-    auto it = table.find(byte);
-    if (it != table.end()) {
-        return it->second;
-    }
-    return "";  // Control character
+    return std::string(decodeByteView(byte, encoding));
 }
 
 // Individual decoding functions
@@ -508,38 +638,31 @@ inline std::string decodeByteJP_G3(unsigned char byte) {
     return decodeByte(byte, TextEncoding::JP_G3);
 }
 
-// Decode text (vector of bytes)
-inline std::string decodeText(const std::vector<unsigned char>& bytes, TextEncoding encoding, 
+// Decode text up to the terminator
+inline std::string decodeText(std::string_view bytes, TextEncoding encoding, 
                               unsigned char terminator = 0x50) {
+    const EncodingTables::DecodeTable& table = EncodingTables::getTable(encoding);
     std::string result;
-    for (unsigned char byte : bytes) {
+    for (char c : bytes) {
+        unsigned char byte = static_cast<unsigned char>(c);
         if (byte == terminator) break;
-        result += decodeByte(byte, encoding);
+        result += table[byte].text;
     }
     return result;
 }
 
+inline std::string decodeText(const std::vector<unsigned char>& bytes, TextEncoding encoding, 
+                              unsigned char terminator = 0x50) {
+    return decodeText(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()),
+                      encoding, terminator);
+}
+
 // ============================================================================
 // Encoding functions
 // ============================================================================
 
-// Build reverse mapping for encoding (cached)
-inline std::unordered_map<std::string, unsigned char> buildReverseTable(TextEncoding encoding) {
-    std::unordered_map<std::string, unsigned char> reverseTable;
-    const auto& table = EncodingTables::getTable(encoding);
-    
-    for (const auto& pair : table) {
-        // Only add if not already present (prefer first occurrence)
-        if (reverseTable.find(pair.second) == reverseTable.end()) {
-            reverseTable[pair.second] = pair.first;
-        }
-    }
-    
-    return reverseTable;
-}
-
 // Encode a single character/string to a byte
-inline unsigned char encodeByte(const std::string& ch, TextEncoding encoding) {
+inline unsigned char encodeByte(std::string_view ch, TextEncoding encoding) {
     if (encoding == TextEncoding::ASCII) {
         if (ch.size() == 1) {
             return static_cast<unsigned char>(ch[0]);
@@ -547,17 +670,19 @@ inline unsigned char encodeByte(const std::string& ch, TextEncoding encoding) {
         return 0;
     }
     
-    // Get cached reverse table
-    static std::unordered_map<TextEncoding, std::unordered_map<std::string, unsigned char>> reverseTables;
-    
-    if (reverseTables.find(encoding) == reverseTables.end()) {
-        reverseTables[encoding] = buildReverseTable(encoding);
+    for (const auto& entry : EncodingTables::ENCODE_OVERRIDES) {
+        if (entry.encoding == encoding && entry.text == ch) {
+            return entry.byte;
+        }
     }
-    
-    const auto& reverseTable = reverseTables[encoding];
-    auto it = reverseTable.find(ch);
-    if (it != reverseTable.end()) {
-        return it->second;
+
+    // Names are short, so scanning the entries beats building a reverse
+    // map, and it needs no mutable state
+    EncodingTables::EntryList list = EncodingTables::getEntries(encoding);
+    for (size_t i = 0; i < list.count; i++) {
+        if (list.entries[i].text == ch && list.entries[i].byte != 0x00) {
+            return list.entries[i].byte;
+        }
     }
     
     // Fall back to ASCII for single characters (Gen1/Gen2 only)
@@ -572,27 +697,27 @@ inline unsigned char encodeByte(const std::string& ch, TextEncoding encoding) {
 }
 
 // Individual encoding functions
-inline unsigned char encodeByteEN_G1(const std::string& ch) {
+inline unsigned char encodeByteEN_G1(std::string_view ch) {
     return encodeByte(ch, TextEncoding::EN_G1);
 }
 
-inline unsigned char encodeByteEN_G2(const std::string& ch) {
+inline unsigned char encodeByteEN_G2(std::string_view ch) {
     return encodeByte(ch, TextEncoding::EN_G2);
 }
 
-inline unsigned char encodeByteEN_G3(const std::string& ch) {
+inline unsigned char encodeByteEN_G3(std::string_view ch) {
     return encodeByte(ch, TextEncoding::EN_G3);
 }
 
-inline unsigned char encodeByteJP_G1(const std::string& ch) {
+inline unsigned char encodeByteJP_G1(std::string_view ch) {
     return encodeByte(ch, TextEncoding::JP_G1);
 }
 
-inline unsigned char encodeByteJP_G2(const std::string& ch) {
+inline unsigned char encodeByteJP_G2(std::string_view ch) {
     return encodeByte(ch, TextEncoding::JP_G2);
 }
 
-inline unsigned char encodeByteJP_G3(const std::string& ch) {
+inline unsigned char encodeByteJP_G3(std::string_view ch) {
     return encodeByte(ch, TextEncoding::JP_G3);
 }
 
@@ -619,7 +744,7 @@ inline std::vector<unsigned char> encodeText(const std::string& text, TextEncodi
         }
         
         // Extract the character
-        std::string ch = text.substr(i, charLen);
+        std::string_view ch = std::string_view(text).substr(i, charLen);
         unsigned char encoded = encodeByte(ch, encoding);
         
         if (encoded != 0) {
@@ -0,0 +1,124 @@
+#include "dirty_bitmap.h"
+#include <algorithm>
+
+void DirtyBitmap::reset(size_t size) {
+    bitCount = size;
+    wordCount = (size + WORD_BITS - 1) / WORD_BITS;
+    size_t blocks = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    blockWords.clear();
+    blockWords.resize(blocks);
+    blockCounts.assign(blocks, 0);
+    setCount = 0;
+}
+
+void DirtyBitmap::clear() {
+    for (size_t block = 0; block < blockCounts.size(); block++) {
+        if (blockCounts[block] != 0) {
+            blockWords[block].reset();
+            blockCounts[block] = 0;
+        }
+    }
+    setCount = 0;
+}
+
+void DirtyBitmap::set(size_t index, bool dirty) {
+    if (index >= bitCount) return;
+
+    size_t block = index / BLOCK_SIZE;
+    std::unique_ptr<uint64_t[]>& words = blockWords[block];
+    if (!words) {
+        if (!dirty) return;
+        words.reset(new uint64_t[WORDS_PER_BLOCK]());
+    }
+
+    uint64_t& word = words[(index / WORD_BITS) % WORDS_PER_BLOCK];
+    uint64_t bit = uint64_t{1} << (index % WORD_BITS);
+    if (((word & bit) != 0) == dirty) return;
+
+    if (dirty) {
+        word |= bit;
+        blockCounts[block]++;
+        setCount++;
+    } else {
+        word &= ~bit;
+        setCount--;
+        if (--blockCounts[block] == 0) {
+            words.reset();
+        }
+    }
+}
+
+bool DirtyBitmap::test(size_t index) const {
+    if (index >= bitCount) return false;
+    return (word(index / WORD_BITS) >> (index % WORD_BITS)) & 1;
+}
+
+uint64_t DirtyBitmap::bits(size_t index, size_t length) const {
+    if (index >= bitCount || length == 0) return 0;
+    length = std::min({length, WORD_BITS, bitCount - index});
+
+    size_t first = index / WORD_BITS;
+    size_t shift = index % WORD_BITS;
+    uint64_t result = word(first) >> shift;
+    if (shift != 0 && first + 1 < wordCount) {
+        result |= word(first + 1) << (WORD_BITS - shift);
+    }
+    return (length == WORD_BITS) ? result : result & ((uint64_t{1} << length) - 1);
+}
+
+// ============================================================================
+// Navigation
+// ============================================================================
+
+size_t DirtyBitmap::findNext(size_t from) const {
+    if (setCount == 0 || from >= bitCount) return NOT_FOUND;
+
+    // Rest of the word holding `from`
+    size_t start = from / WORD_BITS;
+    uint64_t remaining = word(start) >> (from % WORD_BITS);
+    if (remaining != 0) {
+        return from + static_cast<size_t>(__builtin_ctzll(remaining));
+    }
+
+    // Rest of its block, then whole blocks, skipping the clean ones
+    for (size_t block = from / BLOCK_SIZE; block < blockCounts.size(); block++) {
+        if (blockCounts[block] == 0) continue;
+        const uint64_t* words = blockWords[block].get();
+        size_t first = std::max(block * WORDS_PER_BLOCK, start + 1);
+        size_t last = std::min((block + 1) * WORDS_PER_BLOCK, wordCount);
+        for (size_t w = first; w < last; w++) {
+            uint64_t bits = words[w % WORDS_PER_BLOCK];
+            if (bits != 0) {
+                return w * WORD_BITS + static_cast<size_t>(__builtin_ctzll(bits));
+            }
+        }
+    }
+    return NOT_FOUND;
+}
+
+size_t DirtyBitmap::findPrevious(size_t from) const {
+    if (setCount == 0 || bitCount == 0) return NOT_FOUND;
+    if (from >= bitCount) from = bitCount - 1;
+
+    // Start of the word holding `from`
+    size_t start = from / WORD_BITS;
+    size_t shift = WORD_BITS - 1 - (from % WORD_BITS);
+    uint64_t remaining = word(start) << shift;
+    if (remaining != 0) {
+        return from - static_cast<size_t>(__builtin_clzll(remaining));
+    }
+
+    for (size_t block = from / BLOCK_SIZE + 1; block-- > 0;) {
+        if (blockCounts[block] == 0) continue;
+        const uint64_t* words = blockWords[block].get();
+        size_t first = block * WORDS_PER_BLOCK;
+        size_t last = std::min((block + 1) * WORDS_PER_BLOCK, start);
+        for (size_t w = last; w-- > first;) {
+            uint64_t bits = words[w % WORDS_PER_BLOCK];
+            if (bits != 0) {
+                return w * WORD_BITS + (WORD_BITS - 1) - static_cast<size_t>(__builtin_clzll(bits));
+            }
+        }
+    }
+    return NOT_FOUND;
+}
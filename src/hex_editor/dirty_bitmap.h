@@ -0,0 +1,83 @@
+#ifndef DIRTY_BITMAP_H
+#define DIRTY_BITMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// ============================================================================
+// Dirty Bitmap
+// ============================================================================
+// One bit per byte of a buffer, marking the bytes that differ from the file
+// on disk. A second level counts the set bits of every 4KB block, so finding
+// the next or previous set bit and walking all set bits skip clean blocks
+// without touching their words. Only blocks with set bits have words at all,
+// which keeps the bitmap of a multi-GB file at a few bytes per block.
+
+class DirtyBitmap {
+public:
+    static constexpr size_t NOT_FOUND = SIZE_MAX;
+    static constexpr size_t BLOCK_SIZE = 4096;   // bytes per summary entry
+
+    // Clears every bit and sizes the bitmap for `size` bytes
+    void reset(size_t size);
+    void clear();
+
+    void set(size_t index, bool dirty);
+    bool test(size_t index) const;
+
+    size_t count() const { return setCount; }
+    size_t blockCount(size_t block) const { return blockCounts[block]; }
+    bool empty() const { return setCount == 0; }
+
+    // Bits for index .. index + length - 1 (at most 64), bit 0 for index
+    uint64_t bits(size_t index, size_t length) const;
+
+    // First set bit at or after `from` / last one at or before it
+    size_t findNext(size_t from) const;
+    size_t findPrevious(size_t from) const;
+
+    // Calls callback(offset, length) for every run of set bits, in order
+    template <typename Callback>
+    void forEachRun(Callback callback) const;
+
+private:
+    static constexpr size_t WORD_BITS = 64;
+    static constexpr size_t WORDS_PER_BLOCK = BLOCK_SIZE / WORD_BITS;
+
+    std::vector<std::unique_ptr<uint64_t[]>> blockWords;    // null while clean
+    std::vector<uint16_t> blockCounts;
+    size_t bitCount = 0;
+    size_t wordCount = 0;
+    size_t setCount = 0;
+
+    uint64_t word(size_t index) const {
+        const uint64_t* words = blockWords[index / WORDS_PER_BLOCK].get();
+        return words ? words[index % WORDS_PER_BLOCK] : 0;
+    }
+};
+
+template <typename Callback>
+void DirtyBitmap::forEachRun(Callback callback) const {
+    size_t index = findNext(0);
+    while (index != NOT_FOUND) {
+        // Extend the run a word at a time while it stays set
+        size_t end = index + 1;
+        while (end < bitCount) {
+            size_t shift = end % WORD_BITS;
+            uint64_t clear = ~word(end / WORD_BITS) >> shift;
+            if (clear != 0) {
+                end += static_cast<size_t>(__builtin_ctzll(clear));
+                break;
+            }
+            end += WORD_BITS - shift;
+        }
+        if (end > bitCount) end = bitCount;
+
+        callback(index, end - index);
+        index = (end < bitCount) ? findNext(end) : NOT_FOUND;
+    }
+}
+
+#endif // DIRTY_BITMAP_H
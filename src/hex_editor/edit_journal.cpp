@@ -0,0 +1,81 @@
+#include "edit_journal.h"
+
+void EditJournal::clear() {
+    records.clear();
+    applied = 0;
+    oldBytes.clear();
+    newBytes.clear();
+}
+
+void EditJournal::beginTransaction() {
+    if (transactionDepth++ == 0) {
+        openTransaction = nextTransaction++;
+    }
+}
+
+void EditJournal::endTransaction() {
+    if (transactionDepth > 0) {
+        transactionDepth--;
+    }
+}
+
+void EditJournal::record(size_t offset, char oldValue, char newValue) {
+    // A new edit ends the redo history
+    if (applied < records.size()) {
+        size_t dataEnd = records[applied].data;
+        records.resize(applied);
+        oldBytes.resize(dataEnd);
+        newBytes.resize(dataEnd);
+    }
+
+    uint64_t transaction = (transactionDepth > 0) ? openTransaction : nextTransaction++;
+
+    bool extendsLast = !records.empty() &&
+                       records.back().transaction == transaction &&
+                       records.back().offset + records.back().length == offset;
+    if (extendsLast) {
+        records.back().length++;
+    } else {
+        records.push_back(Record{offset, 1, oldBytes.size(), transaction});
+    }
+    oldBytes.push_back(oldValue);
+    newBytes.push_back(newValue);
+    applied = records.size();
+
+    if (memoryUsed() > byteLimit) {
+        trim();
+    }
+}
+
+size_t EditJournal::memoryUsed() const {
+    return records.size() * sizeof(Record) + oldBytes.size() + newBytes.size();
+}
+
+// Drops whole transactions from the oldest end until the journal is down to
+// three quarters of its limit, so trimming (which moves the arenas) happens
+// only once per quarter limit of new edits
+void EditJournal::trim() {
+    const uint64_t newest = records.back().transaction;
+    const size_t target = byteLimit / 4 * 3;
+    const size_t total = memoryUsed();
+
+    size_t cut = 0;
+    size_t freed = 0;
+    while (cut < records.size() && records[cut].transaction != newest && total - freed > target) {
+        uint64_t transaction = records[cut].transaction;
+        while (cut < records.size() && records[cut].transaction == transaction) {
+            freed += sizeof(Record) + 2 * records[cut].length;
+            cut++;
+        }
+    }
+    if (cut == 0) return;
+
+    size_t dataCut = records[cut].data;
+    records.erase(records.begin(), records.begin() + static_cast<std::ptrdiff_t>(cut));
+    for (Record& rec : records) {
+        rec.data -= dataCut;
+    }
+    oldBytes.erase(oldBytes.begin(), oldBytes.begin() + static_cast<std::ptrdiff_t>(dataCut));
+    newBytes.erase(newBytes.begin(), newBytes.begin() + static_cast<std::ptrdiff_t>(dataCut));
+    applied = (applied > cut) ? applied - cut : 0;
+}
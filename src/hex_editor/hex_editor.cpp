@@ -1,9 +1,11 @@
 #include "hex_editor.h"
+#include "../common/search_kernels.h"
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 
 // ============================================================================
 // Constructor
@@ -12,6 +14,7 @@
 HexEditor::HexEditor() 
     : SDLAppBase("GBA/GB Hex Editor", 800, 700)
     , fileSize(0)
+    , addressDigits(8)
     , headerHeight(50)
     , byteGrouping(1)
     , textEncoding(TextEncoding::ASCII)
@@ -28,7 +31,7 @@ HexEditor::HexEditor()
     , targetZoomLevel(1.0f)
     , gotoMode(false)
     , searchMode(false)
-    , currentMatchIndex(0)
+    , nextMatchFrom(0)
     , selectedByteIndex(-1)
     , hasUnsavedChanges(false)
     , overwriteMode(false)
@@ -37,7 +40,16 @@ HexEditor::HexEditor()
     , selectionEnd(-1)
     , saveButtonHovered(false)
     , autoScrollDirection(0)
-    , autoScrollTimer(0.0f) {
+    , autoScrollTimer(0.0f)
+    , rowCacheZoom(0.0f)
+    , rowCacheEncoding(TextEncoding::ASCII)
+    , rowCacheWidth(0)
+    , rowCacheHeight(0) {
+}
+
+HexEditor::~HexEditor() {
+    searchEngine.cancel();
+    clearRowCache();
 }
 
 // ============================================================================
@@ -70,28 +82,40 @@ void HexEditor::setByteGrouping(int grouping) {
 // ============================================================================
 
 bool HexEditor::loadFile(const char* filename) {
-    if (!HexUtils::loadFileToBuffer(filename, fileBuffer, fileSize)) {
+    // The worker may still be reading the mapping that is about to go away
+    searchEngine.reset();
+    
+    if (!HexUtils::loadFileToBuffer(filename, fileBuffer, fileSize, MappedFile::Mode::CopyOnWrite)) {
         std::cerr << "Failed to open: " << filename << std::endl;
         return false;
     }
     
     fileName = filename;
     baseFileName = HexUtils::getBaseName(fileName);
-    savedFileBuffer = fileBuffer;
+    
+    // Pages are copied into the saved state only once they are edited
+    savedPages.reset(fileSize);
+    lastSavedPath.clear();
     
     // Reset state
-    undoStack.clear();
+    editJournal.clear();
     scrollbar.totalItems = (fileSize + ROW_SIZE - 1) / ROW_SIZE;
     scrollbar.offset = 0;
+    fileSizeText = HexUtils::formatFileSize(fileSize);
+    addressDigits = 8;
+    while (addressDigits < 16 && fileSize > 0 && ((fileSize - 1) >> (4 * addressDigits)) != 0) {
+        addressDigits++;
+    }
     hasUnsavedChanges = false;
-    modifiedBytes.clear();
+    modifiedBytes.reset(fileSize);
     selectedByteIndex = -1;
     zoomLevel = 1.0f;
     targetZoomLevel = 1.0f;
     searchMode = false;
     searchInput.clear();
-    searchMatches.clear();
-    currentMatchIndex = 0;
+    searchEngine.reset();
+    nextMatchFrom = 0;
+    clearRowCache();
     
     // Initialize dimensions
     baseCharWidth = charWidth;
@@ -132,16 +156,24 @@ bool HexEditor::saveFile() {
         }
     }
     
-    std::ofstream outFile(outputPath, std::ios::binary);
-    if (!outFile) {
+    // modifiedBytes is exactly what differs from the saved state
+    PatchList patches;
+    modifiedBytes.forEachRun([&patches](size_t offset, size_t length) {
+        patches.add(offset, length);
+    });
+    
+    // The first save to edited_files/ clones the original file; after that the
+    // copy matches the saved state and only needs the newly changed bytes
+    bool saved = (outputPath == lastSavedPath)
+        ? PatchWriter::patchInPlace(outputPath, fileBuffer, fileSize, patches)
+        : PatchWriter::save(fileName, outputPath, fileBuffer, fileSize, patches);
+    if (!saved) {
         std::cerr << "Failed to save: " << outputPath << std::endl;
         return false;
     }
     
-    outFile.write(fileBuffer.data(), static_cast<std::streamsize>(fileSize));
-    outFile.close();
-    
-    savedFileBuffer = fileBuffer;
+    lastSavedPath = outputPath;
+    savedPages.clear();
     modifiedBytes.clear();
     hasUnsavedChanges = false;
     updateWindowTitle();
@@ -171,6 +203,9 @@ bool HexEditor::isJapaneseEncoding() const {
 }
 
 void HexEditor::recalculateLayoutForZoom() {
+    // Cached rows hold the old column positions
+    clearRowCache();
+    
     if (baseCharWidth == 0) {
         baseCharWidth = charWidth;
         baseCharHeight = charHeight;
@@ -188,7 +223,7 @@ void HexEditor::recalculateLayoutForZoom() {
     
     // Calculate layout positions
     addressX = 10;
-    hexX = addressX + effectiveCharWidth * 10;
+    hexX = addressX + effectiveCharWidth * (addressDigits + 2);
     
     int numGroups = ROW_SIZE / byteGrouping;
     int hexSectionWidth = numGroups * (byteGrouping * 2 + 1) * effectiveCharWidth;
@@ -224,7 +259,7 @@ int HexEditor::getByteXPosition(int byteInRow) const {
     return x;
 }
 
-int HexEditor::getByteIndexFromPosition(int x, int y) const {
+int64_t HexEditor::getByteIndexFromPosition(int x, int y) const {
     int contentY = headerHeight + 5 + effectiveCharHeight;
     if (y < contentY) return -1;
     
@@ -242,7 +277,7 @@ int HexEditor::getByteIndexFromPosition(int x, int y) const {
         if (x >= byteX && x < byteEndX) {
             size_t byteIndex = actualRow * ROW_SIZE + i;
             if (byteIndex >= fileSize) return -1;
-            return static_cast<int>(byteIndex);
+            return static_cast<int64_t>(byteIndex);
         }
     }
     
@@ -256,7 +291,7 @@ int HexEditor::getByteIndexFromPosition(int x, int y) const {
 float HexEditor::calculateMaxZoom() const {
     int availableWidth = windowWidth - scrollbar.width - 20;
     
-    int baseHexX = addressX + baseCharWidth * 10;
+    int baseHexX = addressX + baseCharWidth * (addressDigits + 2);
     int numGroups = ROW_SIZE / byteGrouping;
     int baseHexWidth = numGroups * (byteGrouping * 2 + 1) * baseCharWidth + baseCharWidth;
     
@@ -321,6 +356,9 @@ void HexEditor::selectByte(int64_t index) {
         commitEdit();
     }
     
+    if (selectedByteIndex >= 0) {
+        markByteDirty(static_cast<size_t>(selectedByteIndex));
+    }
     selectedByteIndex = index;
     editBuffer.clear();
     
@@ -330,18 +368,69 @@ void HexEditor::selectByte(int64_t index) {
         scrollToAddress(index);
     }
     
+    markByteDirty(static_cast<size_t>(index));
+    markHeaderDirty();
+}
+
+// Selects the next (or previous) modified byte after the selection, or after
+// the top of the view when nothing is selected, wrapping around the file
+void HexEditor::gotoModifiedByte(bool forward) {
+    if (selectedByteIndex >= 0 && !editBuffer.empty()) {
+        commitEdit();
+    }
+    if (modifiedBytes.empty()) return;
+
+    size_t origin = (selectedByteIndex >= 0) ? static_cast<size_t>(selectedByteIndex)
+                                             : scrollbar.offset * ROW_SIZE;
+    size_t target = DirtyBitmap::NOT_FOUND;
+    if (forward) {
+        target = modifiedBytes.findNext(origin + (selectedByteIndex >= 0 ? 1 : 0));
+        if (target == DirtyBitmap::NOT_FOUND) {
+            target = modifiedBytes.findNext(0);
+        }
+    } else {
+        if (origin > 0) {
+            target = modifiedBytes.findPrevious(origin - 1);
+        }
+        if (target == DirtyBitmap::NOT_FOUND) {
+            target = modifiedBytes.findPrevious(fileSize - 1);
+        }
+    }
+    if (target == DirtyBitmap::NOT_FOUND) return;
+
+    clearSelection();
+    selectByte(static_cast<int64_t>(target));
     needsRedraw = true;
 }
 
+SDL_Rect HexEditor::getRowRect(size_t row) const {
+    if (row < scrollbar.offset || row >= scrollbar.offset + scrollbar.visibleItems) {
+        return {0, 0, 0, 0};
+    }
+    int contentY = headerHeight + 5 + effectiveCharHeight;
+    int y = contentY + static_cast<int>(row - scrollbar.offset) * effectiveCharHeight;
+    return {0, y, windowWidth - scrollbar.width, effectiveCharHeight};
+}
+
+void HexEditor::markByteDirty(size_t index) {
+    markDirty(getRowRect(index / ROW_SIZE));
+}
+
+void HexEditor::markHeaderDirty() {
+    markDirty({0, 0, windowWidth, headerHeight});
+}
+
 // ============================================================================
 // Selection Methods
 // ============================================================================
 
 void HexEditor::clearSelection() {
+    if (hasSelectionRange()) {
+        needsRedraw = true;
+    }
     isSelecting = false;
     selectionStart = -1;
     selectionEnd = -1;
-    needsRedraw = true;
 }
 
 bool HexEditor::hasSelectionRange() const {
@@ -365,7 +454,7 @@ void HexEditor::getSelectionRange(int64_t& start, int64_t& end) const {
 void HexEditor::commitEdit() {
     if (selectedByteIndex < 0 || editBuffer.length() != 2) {
         editBuffer.clear();
-        needsRedraw = true;
+        markHeaderDirty();
         return;
     }
     
@@ -374,19 +463,16 @@ void HexEditor::commitEdit() {
     
     if (fileBuffer[selectedByteIndex] != newValue) {
         char oldValue = fileBuffer[selectedByteIndex];
+        searchEngine.reset();
         
-        undoStack.push_back(EditAction{
-            static_cast<size_t>(selectedByteIndex),
-            oldValue,
-            newValue
-        });
+        editJournal.record(static_cast<size_t>(selectedByteIndex), oldValue, newValue);
         
-        fileBuffer[selectedByteIndex] = newValue;
-        updateModifiedState(static_cast<size_t>(selectedByteIndex));
+        writeBytes(static_cast<size_t>(selectedByteIndex), &newValue, 1);
+        markByteDirty(static_cast<size_t>(selectedByteIndex));
     }
     
     editBuffer.clear();
-    needsRedraw = true;
+    markHeaderDirty();
 }
 
 void HexEditor::handleEditInput(char c) {
@@ -404,36 +490,87 @@ void HexEditor::handleEditInput(char c) {
         }
     }
     
-    needsRedraw = true;
+    // Only the status line shows the pending digit
+    markHeaderDirty();
 }
 
 void HexEditor::undoLastEdit() {
-    if (undoStack.empty()) return;
-    
     editBuffer.clear();
+    if (!editJournal.canUndo()) {
+        markHeaderDirty();
+        return;
+    }
+    
+    // The worker must not be reading the buffer while it changes
+    searchEngine.reset();
     
-    EditAction action = undoStack.back();
-    undoStack.pop_back();
+    // Selects the start of the restored bytes afterwards
+    size_t first = SIZE_MAX;
+    editJournal.undo([this, &first](size_t offset, const char* bytes, size_t length) {
+        writeBytes(offset, bytes, length);
+        first = std::min(first, offset);
+    });
     
-    if (action.index < fileSize) {
-        fileBuffer[action.index] = action.oldValue;
-        updateModifiedState(action.index);
+    if (first != SIZE_MAX) {
         clearSelection();
-        selectByte(static_cast<int64_t>(action.index));
+        selectByte(static_cast<int64_t>(first));
     }
+    needsRedraw = true;
+}
+
+void HexEditor::redoLastEdit() {
+    editBuffer.clear();
+    if (!editJournal.canRedo()) {
+        markHeaderDirty();
+        return;
+    }
+    
+    searchEngine.reset();
+    
+    size_t first = SIZE_MAX;
+    editJournal.redo([this, &first](size_t offset, const char* bytes, size_t length) {
+        writeBytes(offset, bytes, length);
+        first = std::min(first, offset);
+    });
     
+    if (first != SIZE_MAX) {
+        clearSelection();
+        selectByte(static_cast<int64_t>(first));
+    }
     needsRedraw = true;
 }
 
-void HexEditor::updateModifiedState(size_t index) {
-    if (index >= fileSize || savedFileBuffer.size() != fileSize) {
+// Every write to fileBuffer goes through here or preserves its pages first,
+// so the saved state is kept before it is overwritten
+void HexEditor::writeBytes(size_t offset, const char* bytes, size_t length) {
+    if (offset >= fileSize) return;
+    length = std::min(length, fileSize - offset);
+    
+    savedPages.preserve(fileBuffer.data(), offset, length);
+    std::memcpy(fileBuffer.data() + offset, bytes, length);
+    updateModifiedState(offset, length);
+    invalidateRange(offset, length);
+}
+
+void HexEditor::updateModifiedState(size_t index, size_t length) {
+    if (index >= fileSize) {
         return;
     }
     
-    if (fileBuffer[index] != savedFileBuffer[index]) {
-        modifiedBytes.insert(index);
-    } else {
-        modifiedBytes.erase(index);
+    size_t end = std::min(index + length, fileSize);
+    for (size_t i = index; i < end; i++) {
+        modifiedBytes.set(i, savedPages.differs(fileBuffer.data(), i));
+    }
+    
+    // Pages that match the saved state again are not needed any more
+    static_assert(SavedPages::PAGE_SIZE == DirtyBitmap::BLOCK_SIZE,
+                  "saved pages and dirty bitmap blocks must line up");
+    if (end > index) {
+        for (size_t page = index / SavedPages::PAGE_SIZE; page <= (end - 1) / SavedPages::PAGE_SIZE; page++) {
+            if (modifiedBytes.blockCount(page) == 0) {
+                savedPages.release(page);
+            }
+        }
     }
     
     hasUnsavedChanges = !modifiedBytes.empty();
@@ -495,19 +632,57 @@ void HexEditor::handlePaste() {
         }
         updateSearchMatches();
     } else if (selectedByteIndex >= 0) {
-        for (char c : text) {
-            if (HexUtils::isHexDigit(c)) {
-                handleEditInput(c);
+        pasteHexBytes(text);
+    }
+    
+    needsRedraw = true;
+}
+
+// Writes the pasted digits from the selected byte on, continuing any digit
+// already typed. The bytes go in as one range, so the modified state and
+// window title are updated once rather than per byte.
+void HexEditor::pasteHexBytes(const std::string& text) {
+    std::string digits = editBuffer;
+    for (char c : text) {
+        if (HexUtils::isHexDigit(c)) {
+            digits += HexUtils::toUpperHex(c);
+        }
+    }
+    
+    size_t offset = static_cast<size_t>(selectedByteIndex);
+    size_t length = std::min(digits.length() / 2, fileSize - offset);
+    std::vector<char> bytes(length);
+    for (size_t i = 0; i < length; i++) {
+        bytes[i] = static_cast<char>(std::stoul(digits.substr(i * 2, 2), nullptr, 16));
+    }
+    
+    if (length > 0) {
+        searchEngine.reset();
+        
+        // The pasted bytes are contiguous, so they become one journal record
+        // that a single undo reverts
+        editJournal.beginTransaction();
+        for (size_t i = 0; i < length; i++) {
+            if (fileBuffer[offset + i] != bytes[i]) {
+                editJournal.record(offset + i, fileBuffer[offset + i], bytes[i]);
             }
         }
+        writeBytes(offset, bytes.data(), length);
+        editJournal.endTransaction();
+        
+        // Like typing, the selection ends after the last byte written
+        editBuffer.clear();
+        selectByte(static_cast<int64_t>(std::min(offset + length, fileSize - 1)));
     }
     
-    needsRedraw = true;
+    // An odd digit stays pending, as if it had been typed
+    editBuffer = (digits.length() % 2 != 0) ? digits.substr(digits.length() - 1) : "";
+    markHeaderDirty();
 }
 
 void HexEditor::appendHexInput(const std::string& text) {
     for (char c : text) {
-        if (HexUtils::isHexDigit(c) && gotoAddressInput.length() < 8) {
+        if (HexUtils::isHexDigit(c) && gotoAddressInput.length() < static_cast<size_t>(addressDigits)) {
             gotoAddressInput += HexUtils::toUpperHex(c);
         }
     }
@@ -518,88 +693,55 @@ void HexEditor::appendHexInput(const std::string& text) {
 // ============================================================================
 
 void HexEditor::updateSearchMatches() {
-    searchMatches.clear();
-    currentMatchIndex = 0;
+    nextMatchFrom = 0;
+    needsRedraw = true;
     
-    if (searchInput.empty() || searchInput.length() % 2 != 0) {
-        needsRedraw = true;
+    if (searchInput.empty()) {
+        searchEngine.reset();
         return;
     }
     
-    // Convert search input to bytes
-    std::vector<unsigned char> searchBytes;
-    for (size_t i = 0; i < searchInput.length(); i += 2) {
-        std::string byteStr = searchInput.substr(i, 2);
-        unsigned char byte = static_cast<unsigned char>(std::stoul(byteStr, nullptr, 16));
-        searchBytes.push_back(byte);
-    }
-    
-    if (searchBytes.empty() || searchBytes.size() > fileSize) {
-        needsRedraw = true;
+    // A half-typed byte leaves the last search in place for the next digit
+    // to refine
+    if (searchInput.length() % 2 != 0) {
         return;
     }
     
-    // Search through file buffer
-    for (size_t i = 0; i <= fileSize - searchBytes.size(); i++) {
-        bool match = true;
-        for (size_t j = 0; j < searchBytes.size(); j++) {
-            if (static_cast<unsigned char>(fileBuffer[i + j]) != searchBytes[j]) {
-                match = false;
-                break;
-            }
-        }
-        if (match) {
-            searchMatches.push_back(i);
-        }
+    std::vector<uint8_t> pattern(searchInput.length() / 2);
+    for (size_t i = 0; i < pattern.size(); i++) {
+        int high = HexUtils::hexDigitValue(searchInput[i * 2]);
+        int low = HexUtils::hexDigitValue(searchInput[i * 2 + 1]);
+        pattern[i] = static_cast<uint8_t>((high << 4) | low);
     }
     
-    needsRedraw = true;
+    searchEngine.start(reinterpret_cast<const uint8_t*>(fileBuffer.data()), fileSize,
+                       std::move(pattern));
 }
 
 void HexEditor::gotoNextMatch() {
-    if (searchMatches.empty()) return;
-    
-    size_t matchAddr = searchMatches[currentMatchIndex];
-    scrollToAddress(matchAddr);
-    selectByte(static_cast<int64_t>(matchAddr));
-    
-    currentMatchIndex = (currentMatchIndex + 1) % searchMatches.size();
+    const std::vector<uint8_t>& pattern = searchEngine.results().pattern;
+    if (pattern.empty() || searchInput.length() % 2 != 0) return;
+    
+    // Scans on from the previous match rather than using the stored matches,
+    // so Enter works before the background search has finished
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(fileBuffer.data());
+    size_t from = (nextMatchFrom < fileSize) ? nextMatchFrom : 0;
+    size_t hit = SearchKernels::find(data + from, fileSize - from, pattern.data(), pattern.size());
+    if (hit != SearchKernels::NOT_FOUND) {
+        hit += from;
+    } else if (from > 0) {
+        // Wrap around to the matches that start before `from`
+        size_t wrapBytes = std::min(fileSize, from + pattern.size() - 1);
+        hit = SearchKernels::find(data, wrapBytes, pattern.data(), pattern.size());
+    }
+    if (hit == SearchKernels::NOT_FOUND) return;
+    
+    scrollToAddress(hit);
+    selectByte(static_cast<int64_t>(hit));
+    nextMatchFrom = hit + 1;
     needsRedraw = true;
 }
 
-// ============================================================================
-// Text Analysis
-// ============================================================================
-
-bool HexEditor::containsJapaneseCharacters(const std::string& text) const {
-    for (size_t i = 0; i < text.length(); i++) {
-        unsigned char byte = static_cast<unsigned char>(text[i]);
-        
-        // Multi-byte UTF-8 sequences (likely Japanese)
-        if ((byte & 0xE0) == 0xC0 || (byte & 0xF0) == 0xE0 || (byte & 0xF8) == 0xF0) {
-            return true;
-        }
-    }
-    return false;
-}
-
-size_t HexEditor::getVisualCellCount(const std::string& text) const {
-    size_t cellCount = 0;
-    size_t i = 0;
-    
-    while (i < text.length()) {
-        UTF8CharInfo charInfo = analyzeUTF8Char(text, i);
-        
-        if (!charInfo.isCombiningMark) {
-            cellCount++;
-        }
-        
-        i += charInfo.byteLength;
-    }
-    
-    return cellCount;
-}
-
 // ============================================================================
 // SDLAppBase Overrides
 // ============================================================================
@@ -608,6 +750,12 @@ void HexEditor::onResize(int /*newWidth*/, int /*newHeight*/) {
     recalculateLayoutForZoom();
 }
 
+bool HexEditor::isAnimating() const {
+    return SDLAppBase::isAnimating() || searchEngine.isActive() ||
+           std::abs(targetZoomLevel - zoomLevel) > 0.001f ||
+           (isSelecting && autoScrollDirection != 0);
+}
+
 void HexEditor::update(float deltaTime) {
     bool needsLayoutUpdate = false;
     
@@ -657,6 +805,13 @@ void HexEditor::update(float deltaTime) {
     // Let base class handle momentum scrolling
     SDLAppBase::update(deltaTime);
     
+    // Background search: progress in the header, then its matches
+    if (searchEngine.isRunning()) {
+        markHeaderDirty();
+    } else if (searchEngine.poll()) {
+        needsLayoutUpdate = true;
+    }
+    
     if (needsLayoutUpdate) {
         needsRedraw = true;
     }
@@ -774,8 +929,8 @@ void HexEditor::handleGotoInput(SDL_Keycode key, Uint16 mod) {
                 gotoMode = false;
                 searchMode = true;
                 searchInput.clear();
-                searchMatches.clear();
-                currentMatchIndex = 0;
+                searchEngine.reset();
+                nextMatchFrom = 0;
             }
             break;
             
@@ -812,8 +967,8 @@ void HexEditor::handleSearchInput(SDL_Keycode key, Uint16 mod) {
         case SDLK_ESCAPE:
             searchMode = false;
             searchInput.clear();
-            searchMatches.clear();
-            currentMatchIndex = 0;
+            searchEngine.reset();
+            nextMatchFrom = 0;
             break;
             
         case SDLK_BACKSPACE:
@@ -921,7 +1076,14 @@ void HexEditor::handleKeyDown(SDL_Keycode key, Uint16 mod) {
     if (hasModifier) {
         switch (key) {
             case SDLK_Z:
-                undoLastEdit();
+                if (mod & SDL_KMOD_SHIFT) {
+                    redoLastEdit();
+                } else {
+                    undoLastEdit();
+                }
+                return;
+            case SDLK_Y:
+                redoLastEdit();
                 return;
             case SDLK_S:
                 saveFile();
@@ -978,11 +1140,15 @@ void HexEditor::handleKeyDown(SDL_Keycode key, Uint16 mod) {
             needsRedraw = true;
             break;
             
+        case SDLK_N:
+            gotoModifiedByte(!(mod & SDL_KMOD_SHIFT));
+            break;
+            
         case SDLK_S:
             searchMode = true;
             searchInput.clear();
-            searchMatches.clear();
-            currentMatchIndex = 0;
+            searchEngine.reset();
+            nextMatchFrom = 0;
             needsRedraw = true;
             break;
             
@@ -1050,7 +1216,7 @@ void HexEditor::handleMouseDown(int x, int y) {
     }
     
     // Check hex content area
-    int byteIndex = getByteIndexFromPosition(x, y);
+    int64_t byteIndex = getByteIndexFromPosition(x, y);
     if (byteIndex >= 0) {
         if (selectedByteIndex >= 0 && !editBuffer.empty()) {
             commitEdit();
@@ -1080,7 +1246,6 @@ void HexEditor::handleMouseUp() {
         isSelecting = false;
         autoScrollDirection = 0;
         autoScrollTimer = 0.0f;
-        needsRedraw = true;
     }
 }
 
@@ -1094,7 +1259,7 @@ void HexEditor::handleMouseMotion(int x, int y) {
     bool wasHovered = saveButtonHovered;
     saveButtonHovered = isPointInRect(x, y, saveButtonRect);
     if (wasHovered != saveButtonHovered) {
-        needsRedraw = true;
+        markHeaderDirty();
     }
     
     // Handle selection dragging
@@ -1112,7 +1277,7 @@ void HexEditor::handleMouseMotion(int x, int y) {
             autoScrollDirection = 0;
         }
         
-        int byteIndex = getByteIndexFromPosition(x, y);
+        int64_t byteIndex = getByteIndexFromPosition(x, y);
         if (byteIndex >= 0 && byteIndex != selectionEnd) {
             selectionEnd = byteIndex;
             needsRedraw = true;
@@ -1143,14 +1308,11 @@ void HexEditor::renderHeader() {
     renderFilledRect(headerRect, colors.headerBg);
     
     // File info line
-    std::stringstream ss;
-    ss << baseFileName << " | " << HexUtils::formatFileSize(fileSize);
-    if (overwriteMode) {
-        ss << " [OVERWRITE]";
-    }
-    if (hasUnsavedChanges) {
-        ss << " [MODIFIED]";
-    }
+    std::string_view fileInfo = frameArena.concat({
+        baseFileName, " | ", fileSizeText,
+        overwriteMode ? " [OVERWRITE]" : "",
+        hasUnsavedChanges ? " [MODIFIED]" : ""
+    });
     
     SDL_Color headerColor = colors.text;
     if (overwriteMode) {
@@ -1159,25 +1321,31 @@ void HexEditor::renderHeader() {
         headerColor = colors.error;
     }
     
-    renderText(ss.str(), 10, 5, headerColor);
+    renderText(fileInfo, 10, 5, headerColor);
     
     // Status line
-    ss.str("");
     size_t currentAddr = scrollbar.offset * ROW_SIZE;
     size_t endAddr = std::min(currentAddr + scrollbar.visibleItems * ROW_SIZE, fileSize);
+    std::string_view zoomPercent = HexUtils::toDecimalView(
+        frameArena, static_cast<uint64_t>(zoomLevel * 100 + 0.5f));
     
+    std::string_view status;
     if (selectedByteIndex >= 0) {
-        ss << "Selected: 0x" << HexUtils::toHexString(selectedByteIndex, 8);
-        if (!editBuffer.empty()) {
-            ss << " [" << editBuffer << "_]";
-        }
+        bool editing = !editBuffer.empty();
+        status = frameArena.concat({
+            "Selected: 0x", HexUtils::toHexView(frameArena, selectedByteIndex, addressDigits),
+            editing ? " [" : "", editBuffer, editing ? "_]" : "",
+            " | Zoom: ", zoomPercent, "%"
+        });
     } else {
-        ss << "Offset: 0x" << HexUtils::toHexString(currentAddr, 8) 
-           << " - 0x" << HexUtils::toHexString(endAddr, 8);
+        status = frameArena.concat({
+            "Offset: 0x", HexUtils::toHexView(frameArena, currentAddr, addressDigits),
+            " - 0x", HexUtils::toHexView(frameArena, endAddr, addressDigits),
+            " | Zoom: ", zoomPercent, "%"
+        });
     }
-    ss << " | Zoom: " << static_cast<int>(zoomLevel * 100 + 0.5f) << "%";
     
-    renderText(ss.str(), 10, 5 + charHeight, colors.text);
+    renderText(status, 10, 5 + charHeight, colors.text);
     
     // Right side controls
     int rightX = windowWidth - scrollbar.width;
@@ -1198,8 +1366,7 @@ void HexEditor::renderHeader() {
     if (gotoMode) {
         SDL_Rect inputRect = {rightX - 120, 8, 115, charHeight + 8};
         renderFilledRect(inputRect, colors.inputBg);
-        std::string prompt = "0x" + gotoAddressInput + "_";
-        renderText(prompt, rightX - 115, 10, colors.accent);
+        renderText(frameArena.concat({"0x", gotoAddressInput, "_"}), rightX - 115, 10, colors.accent);
     } else if (searchMode) {
         SDL_Rect inputRect = {rightX - 120, 8, 115, charHeight + 8};
         renderFilledRect(inputRect, colors.inputBg);
@@ -1208,10 +1375,17 @@ void HexEditor::renderHeader() {
         int availableWidth = 105;
         int prefixWidth = charWidth * 2;
         
-        std::string matchStr;
+        std::string_view matchStr;
         if (!searchInput.empty() && searchInput.length() % 2 == 0) {
-            size_t numMatches = searchMatches.size();
-            matchStr = (numMatches > 99) ? "(99+)" : "(" + std::to_string(numMatches) + ")";
+            if (searchEngine.isRunning()) {
+                size_t percent = std::min<size_t>(99, static_cast<size_t>(searchEngine.progress() * 100.0f));
+                matchStr = frameArena.concat({"(", HexUtils::toDecimalView(frameArena, percent), "%)"});
+            } else {
+                size_t numMatches = searchEngine.results().matchCount;
+                matchStr = (numMatches > 99) 
+                         ? "(99+)" 
+                         : frameArena.concat({"(", HexUtils::toDecimalView(frameArena, numMatches), ")"});
+            }
         }
         int matchWidth = static_cast<int>(matchStr.length()) * charWidth;
         int cursorWidth = charWidth;
@@ -1219,12 +1393,12 @@ void HexEditor::renderHeader() {
         int inputAvailableWidth = availableWidth - prefixWidth - matchWidth - cursorWidth;
         int maxVisibleChars = std::max(0, inputAvailableWidth / charWidth);
         
-        std::string visibleInput = searchInput;
+        std::string_view visibleInput = searchInput;
         if (static_cast<int>(searchInput.length()) > maxVisibleChars && maxVisibleChars > 0) {
-            visibleInput = searchInput.substr(searchInput.length() - maxVisibleChars);
+            visibleInput = visibleInput.substr(searchInput.length() - maxVisibleChars);
         }
         
-        std::string displayStr = "S:" + visibleInput + "_" + matchStr;
+        std::string_view displayStr = frameArena.concat({"S:", visibleInput, "_", matchStr});
         renderText(displayStr, rightX - 115, 10, colors.accent);
     } else {
         renderText("G:Goto S:Search", rightX - 120, 18, colors.textDim);
@@ -1235,76 +1409,266 @@ void HexEditor::renderHeader() {
 }
 
 void HexEditor::renderDecodedContent(int y, size_t address, size_t bytesInRow) {
-    // Build decoded string
-    std::string decodedStr;
-    std::vector<std::string> decodedChars;
-    bool hasJapanese = false;
+    std::string_view decodedChars[ROW_SIZE];
+    size_t decodedLength = 0;
+    size_t visualCells = 0;
     
     for (size_t i = 0; i < bytesInRow; i++) {
         unsigned char c = fileBuffer[address + i];
-        std::string decoded = decodeByte(c, textEncoding);
+        const EncodingTables::DecodedChar& decoded = decodeChar(c, textEncoding);
         
-        if (decoded.empty()) {
-            decoded = ".";
+        if (decoded.text.empty()) {
+            decodedChars[i] = ".";
+            visualCells++;
+        } else {
+            decodedChars[i] = decoded.text;
+            visualCells += decoded.cells;
         }
+        decodedLength += decodedChars[i].size();
+    }
+    
+    // Build the row in the frame arena, padded to ROW_SIZE visual cells
+    size_t padding = (visualCells < ROW_SIZE) ? ROW_SIZE - visualCells : 0;
+    char* decodedStr = frameArena.allocate(decodedLength + padding);
+    size_t length = 0;
+    for (size_t i = 0; i < bytesInRow; i++) {
+        length += decodedChars[i].copy(decodedStr + length, decodedChars[i].size());
+    }
+    std::fill_n(decodedStr + length, padding, ' ');
+    length += padding;
+    
+    // Render with appropriate method
+    if (japaneseFont && isJapaneseEncoding()) {
+        renderMixedTextScaledWithCellWidth(std::string_view(decodedStr, length), asciiX, y, 
+                                           colors.success, zoomLevel, decodedCellWidth);
+    } else {
+        renderTextScaled(std::string_view(decodedStr, length), asciiX, y, colors.success, zoomLevel);
+    }
+}
+
+// Bytes of the row covered by any match, found by binary search so the cost
+// depends on the matches near the row rather than on the whole file
+uint16_t HexEditor::getSearchMask(size_t row, const SearchResults& search) const {
+    const size_t matchLen = search.pattern.size();
+    const size_t rowStart = row * ROW_SIZE;
+    const size_t rowEnd = std::min(rowStart + ROW_SIZE, fileSize);
+    if (matchLen == 0 || rowStart >= rowEnd) return 0;
+    
+    // The first match that can reach into the row starts matchLen - 1 bytes
+    // before it
+    size_t firstStart = (rowStart >= matchLen - 1) ? rowStart - (matchLen - 1) : 0;
+    auto it = std::lower_bound(search.matches.begin(), search.matches.end(), firstStart);
+    
+    uint32_t mask = 0;
+    for (; it != search.matches.end() && *it < rowEnd; ++it) {
+        size_t start = std::max(*it, rowStart);
+        size_t end = std::min(*it + matchLen, rowEnd);
+        mask |= ((1u << (end - start)) - 1u) << (start - rowStart);
+        if (mask == (1u << (rowEnd - rowStart)) - 1u) break;
+    }
+    return static_cast<uint16_t>(mask);
+}
+
+HexEditor::RowHighlight HexEditor::getRowHighlight(
+    size_t row, int64_t selStart, int64_t selEnd,
+    const SearchResults* search) const {
+    
+    RowHighlight highlight;
+    size_t address = row * ROW_SIZE;
+    size_t bytesInRow = std::min(static_cast<size_t>(ROW_SIZE), fileSize - address);
+    uint16_t searchMask = search ? getSearchMask(row, *search) : 0;
+    
+    for (size_t i = 0; i < bytesInRow; i++) {
+        size_t byteIndex = address + i;
+        uint16_t bit = static_cast<uint16_t>(1u << i);
         
-        decodedChars.push_back(decoded);
-        decodedStr += decoded;
-        
-        if (!hasJapanese && containsJapaneseCharacters(decoded)) {
-            hasJapanese = true;
+        bool isSelected = (static_cast<int64_t>(byteIndex) == selectedByteIndex);
+        bool inSelection = (selStart >= 0 && selEnd >= 0 && 
+                           static_cast<int64_t>(byteIndex) >= selStart && 
+                           static_cast<int64_t>(byteIndex) <= selEnd);
+        if (isSelected || inSelection) {
+            highlight.selected |= bit;
+        } else if (searchMask & bit) {
+            highlight.searched |= bit;
         }
     }
+    highlight.modified = static_cast<uint16_t>(modifiedBytes.bits(address, bytesInRow));
+    return highlight;
+}
+
+void HexEditor::renderRow(int y, size_t row, const RowHighlight& highlight) {
+    size_t address = row * ROW_SIZE;
+    size_t bytesInRow = std::min(static_cast<size_t>(ROW_SIZE), fileSize - address);
     
-    // Pad to ROW_SIZE visual cells
-    size_t visualCells = 0;
-    for (const auto& ch : decodedChars) {
-        visualCells += getVisualCellCount(ch);
+    // Alternating row background, tied to the row so cached rows stay valid
+    // while scrolling
+    if (row % 2 == 1) {
+        SDL_Rect rowRect = {0, y, windowWidth - scrollbar.width, effectiveCharHeight};
+        renderFilledRect(rowRect, {35, 35, 35, 255});
     }
-    while (visualCells < ROW_SIZE) {
-        decodedStr += ' ';
-        visualCells++;
+    
+    // The row's text is queued and drawn in one batch over its highlights
+    beginTextBatch();
+    
+    // Address column
+    renderTextScaled(HexUtils::toHexView(frameArena, address, addressDigits), addressX, y, colors.accent, zoomLevel);
+    
+    // Hex bytes
+    for (size_t i = 0; i < bytesInRow; i++) {
+        int byteX = getByteXPosition(static_cast<int>(i));
+        uint16_t bit = static_cast<uint16_t>(1u << i);
+        
+        // Draw highlight background
+        if (highlight.selected & bit) {
+            SDL_Rect selectRect = {byteX, y, effectiveCharWidth * 2, effectiveCharHeight};
+            renderFilledRect(selectRect, colors.selectedBg);
+        } else if (highlight.searched & bit) {
+            SDL_Rect highlightRect = {byteX, y, effectiveCharWidth * 2, effectiveCharHeight};
+            renderFilledRect(highlightRect, {80, 80, 0, 255});
+        }
+        
+        // Draw byte value
+        unsigned char byte = fileBuffer[address + i];
+        SDL_Color byteColor = (highlight.modified & bit) ? colors.warning : colors.text;
+        renderTextScaled(HexUtils::byteHex(byte), byteX, y, byteColor, zoomLevel);
     }
     
-    // Render with appropriate method
-    if (japaneseFont && isJapaneseEncoding()) {
-        renderMixedTextScaledWithCellWidth(decodedStr, asciiX, y, colors.success, 
-                                           zoomLevel, decodedCellWidth);
+    // Decoded content
+    renderDecodedContent(y, address, bytesInRow);
+    flushTextBatch();
+}
+
+bool HexEditor::renderCachedRow(int y, size_t row, const RowHighlight& highlight) {
+    SDL_FRect dest = {0.0f, static_cast<float>(y), 
+                      static_cast<float>(rowCacheWidth), static_cast<float>(rowCacheHeight)};
+    
+    auto it = rowCache.find(row);
+    if (it != rowCache.end() && it->second.highlight == highlight) {
+        SDL_RenderTexture(renderer, it->second.texture, nullptr, &dest);
+        return true;
+    }
+    
+    SDL_Texture* texture = nullptr;
+    if (it != rowCache.end()) {
+        texture = it->second.texture;
     } else {
-        renderTextScaled(decodedStr, asciiX, y, colors.success, zoomLevel);
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                    rowCacheWidth, rowCacheHeight);
+        if (!texture) {
+            return false;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+    }
+    
+    // Redraw the row into its texture, then composite it like a cached one
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, texture);
+    SDL_SetRenderDrawColor(renderer, colors.background.r, colors.background.g,
+                           colors.background.b, colors.background.a);
+    SDL_RenderClear(renderer);
+    renderRow(0, row, highlight);
+    SDL_SetRenderTarget(renderer, previousTarget);
+    
+    rowCache[row] = CachedRow{texture, highlight};
+    SDL_RenderTexture(renderer, texture, nullptr, &dest);
+    return true;
+}
+
+void HexEditor::invalidateRow(size_t row) {
+    auto it = rowCache.find(row);
+    if (it != rowCache.end()) {
+        SDL_DestroyTexture(it->second.texture);
+        rowCache.erase(it);
+    }
+}
+
+void HexEditor::invalidateRange(size_t offset, size_t length) {
+    if (length == 0) return;
+    size_t firstRow = offset / ROW_SIZE;
+    size_t lastRow = (offset + length - 1) / ROW_SIZE;
+    
+    // Large ranges walk the cache, which only holds rows near the view
+    if (lastRow - firstRow >= rowCache.size()) {
+        for (auto it = rowCache.begin(); it != rowCache.end();) {
+            if (it->first >= firstRow && it->first <= lastRow) {
+                SDL_DestroyTexture(it->second.texture);
+                it = rowCache.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return;
+    }
+    for (size_t row = firstRow; row <= lastRow; row++) {
+        invalidateRow(row);
+    }
+}
+
+void HexEditor::clearRowCache() {
+    // Textures went away with the renderer if it is already destroyed
+    if (renderer) {
+        for (auto& entry : rowCache) {
+            SDL_DestroyTexture(entry.second.texture);
+        }
+    }
+    rowCache.clear();
+}
+
+void HexEditor::evictDistantRows() {
+    // Keep a screenful on either side of the view for scrolling back and forth
+    size_t first = (scrollbar.offset > scrollbar.visibleItems) 
+                 ? scrollbar.offset - scrollbar.visibleItems : 0;
+    size_t last = scrollbar.offset + 2 * scrollbar.visibleItems;
+    
+    for (auto it = rowCache.begin(); it != rowCache.end();) {
+        if (it->first < first || it->first >= last) {
+            SDL_DestroyTexture(it->second.texture);
+            it = rowCache.erase(it);
+        } else {
+            ++it;
+        }
     }
 }
 
 void HexEditor::render() {
-    SDL_SetRenderDrawColor(renderer, colors.background.r, colors.background.g, 
-                          colors.background.b, 255);
-    SDL_RenderClear(renderer);
+    clearDirtyRegions(colors.background);
     SDL_SetRenderScale(renderer, 1.0f, 1.0f);
     
-    renderHeader();
+    if (isRegionDirty({0, 0, windowWidth, headerHeight})) {
+        renderHeader();
+    }
     
     if (fileSize == 0) {
         renderText("No file loaded.", 10, headerHeight + 20, colors.text);
-        SDL_RenderPresent(renderer);
         return;
     }
     
     int y = headerHeight + 5;
     
     // Column headers
-    renderTextScaled("Address", addressX, y, colors.textDim, zoomLevel);
-    for (int i = 0; i < ROW_SIZE; ++i) {
-        int headerByteX = getByteXPosition(i);
-        renderTextScaled(HexUtils::toHexString(i, 2), headerByteX, y, colors.textDim, zoomLevel);
+    SDL_Rect columnHeaderRect = {0, headerHeight, windowWidth - scrollbar.width,
+                                 5 + effectiveCharHeight};
+    bool columnHeaderDirty = isRegionDirty(columnHeaderRect);
+    if (columnHeaderDirty) {
+        beginTextBatch();
+        renderTextScaled("Address", addressX, y, colors.textDim, zoomLevel);
+        for (int i = 0; i < ROW_SIZE; ++i) {
+            int headerByteX = getByteXPosition(i);
+            renderTextScaled(HexUtils::byteHex(static_cast<unsigned char>(i)), headerByteX, y, 
+                             colors.textDim, zoomLevel);
+        }
+        
+        std::string_view decodedHeader = (textEncoding != TextEncoding::ASCII) 
+                                        ? getEncodingNameView(textEncoding) : "Decoded";
+        renderTextScaled(decodedHeader, asciiX, y, colors.textDim, zoomLevel);
+        flushTextBatch();
     }
-    
-    std::string decodedHeader = (textEncoding != TextEncoding::ASCII) 
-                               ? getEncodingName(textEncoding) : "Decoded";
-    renderTextScaled(decodedHeader, asciiX, y, colors.textDim, zoomLevel);
     y += effectiveCharHeight;
     
     // Header separator
-    renderLine(addressX, y - 2, windowWidth - scrollbar.width - 5, y - 2, {50, 50, 50, 255});
+    if (columnHeaderDirty) {
+        renderLine(addressX, y - 2, windowWidth - scrollbar.width - 5, y - 2, {50, 50, 50, 255});
+    }
     
     // Prepare selection and search highlight info
     int64_t selStart = -1, selEnd = -1;
@@ -1312,14 +1676,26 @@ void HexEditor::render() {
         getSelectionRange(selStart, selEnd);
     }
     
-    std::set<size_t> searchHighlights;
-    if (searchMode && !searchMatches.empty() && searchInput.length() >= 2) {
-        size_t matchLen = searchInput.length() / 2;
-        for (size_t matchAddr : searchMatches) {
-            for (size_t j = 0; j < matchLen; j++) {
-                searchHighlights.insert(matchAddr + j);
-            }
-        }
+    // Matches are looked up per visible row, so nothing here scales with
+    // the number of matches in the file
+    const SearchResults& searchResults = searchEngine.results();
+    const SearchResults* searchHighlights = nullptr;
+    if (searchMode && searchResults.complete && !searchResults.matches.empty() &&
+        !searchInput.empty() && searchInput.length() % 2 == 0) {
+        searchHighlights = &searchResults;
+    }
+    
+    // Rows are drawn from the cache, except while a zoom transition would
+    // make every cached row stale on every frame
+    int rowWidth = windowWidth - scrollbar.width;
+    bool useRowCache = std::abs(targetZoomLevel - zoomLevel) <= 0.001f;
+    if (useRowCache && (rowCacheZoom != zoomLevel || rowCacheEncoding != textEncoding ||
+                        rowCacheWidth != rowWidth || rowCacheHeight != effectiveCharHeight)) {
+        clearRowCache();
+        rowCacheZoom = zoomLevel;
+        rowCacheEncoding = textEncoding;
+        rowCacheWidth = rowWidth;
+        rowCacheHeight = effectiveCharHeight;
     }
     
     // Render rows
@@ -1327,56 +1703,19 @@ void HexEditor::render() {
          (scrollbar.offset + row) < scrollbar.totalItems; row++) {
         
         size_t currentRow = scrollbar.offset + row;
-        size_t address = currentRow * ROW_SIZE;
-        size_t bytesInRow = std::min(static_cast<size_t>(ROW_SIZE), fileSize - address);
-        
-        // Alternating row background
-        if (row % 2 == 1) {
-            SDL_Rect rowRect = {0, y, windowWidth - scrollbar.width, effectiveCharHeight};
-            renderFilledRect(rowRect, {35, 35, 35, 255});
-        }
-        
-        // Address column
-        renderTextScaled(HexUtils::toHexString(address, 8), addressX, y, colors.accent, zoomLevel);
-        
-        // Hex bytes
-        for (size_t i = 0; i < ROW_SIZE; i++) {
-            size_t byteIndex = address + i;
-            int byteX = getByteXPosition(static_cast<int>(i));
-            
-            if (i >= bytesInRow) continue;
-            
-            // Determine highlight state
-            bool isSelected = (static_cast<int64_t>(byteIndex) == selectedByteIndex);
-            bool inSelection = (selStart >= 0 && selEnd >= 0 && 
-                               static_cast<int64_t>(byteIndex) >= selStart && 
-                               static_cast<int64_t>(byteIndex) <= selEnd);
-            bool inSearchMatch = searchHighlights.count(byteIndex) > 0;
-            
-            // Draw highlight background
-            if (isSelected || inSelection) {
-                SDL_Rect selectRect = {byteX, y, effectiveCharWidth * 2, effectiveCharHeight};
-                renderFilledRect(selectRect, colors.selectedBg);
-            } else if (inSearchMatch) {
-                SDL_Rect highlightRect = {byteX, y, effectiveCharWidth * 2, effectiveCharHeight};
-                renderFilledRect(highlightRect, {80, 80, 0, 255});
+        if (isRegionDirty({0, y, rowWidth, effectiveCharHeight})) {
+            RowHighlight highlight = getRowHighlight(currentRow, selStart, selEnd, searchHighlights);
+            if (!useRowCache || !renderCachedRow(y, currentRow, highlight)) {
+                renderRow(y, currentRow, highlight);
             }
-            
-            // Draw byte value
-            unsigned char byte = fileBuffer[byteIndex];
-            std::string byteStr = HexUtils::toHexString(byte, 2);
-            SDL_Color byteColor = modifiedBytes.count(byteIndex) ? colors.warning : colors.text;
-            renderTextScaled(byteStr, byteX, y, byteColor, zoomLevel);
         }
-        
-        // Decoded content
-        renderDecodedContent(y, address, bytesInRow);
-        
         y += effectiveCharHeight;
     }
+    evictDistantRows();
     
-    renderScrollbar();
-    SDL_RenderPresent(renderer);
+    if (isRegionDirty(getScrollbarRect())) {
+        renderScrollbar();
+    }
 }
 
 // ============================================================================
@@ -1386,9 +1725,14 @@ void HexEditor::render() {
 bool HexEditor::applyBatchEdits(
     const std::vector<std::pair<size_t, std::vector<unsigned char>>>& edits) {
     
+    searchEngine.reset();
+    
+    // All edits undo as one step
+    editJournal.beginTransaction();
     for (const auto& edit : edits) {
         size_t addr = edit.first;
         const std::vector<unsigned char>& bytes = edit.second;
+        size_t written = 0;
         
         for (size_t i = 0; i < bytes.size(); i++) {
             size_t targetAddr = addr + i;
@@ -1403,12 +1747,17 @@ bool HexEditor::applyBatchEdits(
             char newValue = static_cast<char>(bytes[i]);
             
             if (oldValue != newValue) {
-                undoStack.push_back(EditAction{targetAddr, oldValue, newValue});
+                editJournal.record(targetAddr, oldValue, newValue);
+                savedPages.preserve(fileBuffer.data(), targetAddr, 1);
                 fileBuffer[targetAddr] = newValue;
-                updateModifiedState(targetAddr);
             }
+            written = i + 1;
         }
+        
+        updateModifiedState(addr, written);
+        invalidateRange(addr, written);
     }
+    editJournal.endTransaction();
     
     needsRedraw = true;
     return true;
@@ -3,9 +3,14 @@
 
 #include "../common/sdl_app_base.h"
 #include "../common/hex_utils.h"
+#include "../common/patch_writer.h"
 #include "../encodings/text_encodings.h"
+#include "dirty_bitmap.h"
+#include "edit_journal.h"
+#include "saved_pages.h"
+#include "search_engine.h"
 #include <string>
-#include <set>
+#include <unordered_map>
 #include <vector>
 
 #ifdef _WIN32
@@ -16,16 +21,6 @@
 #define MKDIR(path) mkdir(path, 0755)
 #endif
 
-// ============================================================================
-// Edit Action (for undo functionality)
-// ============================================================================
-
-struct EditAction {
-    size_t index;
-    char oldValue;
-    char newValue;
-};
-
 // ============================================================================
 // Hex Editor Class
 // ============================================================================
@@ -46,11 +41,14 @@ private:
     // ========================================================================
     // File Data
     // ========================================================================
-    std::string fileBuffer;
-    std::string savedFileBuffer;
+    MappedFile fileBuffer;       // copy-on-write: untouched pages stay shared with the page cache
+    SavedPages savedPages;       // last saved contents of the pages edited since
     std::string fileName;
     std::string baseFileName;
     size_t fileSize;
+    std::string fileSizeText;   // formatted once per load for the header
+    int addressDigits;          // hex digits in an address; 8 up to 4GB
+    std::string lastSavedPath;  // output file known to match the saved state
     
     // ========================================================================
     // Display Configuration
@@ -93,8 +91,8 @@ private:
     
     bool searchMode;
     std::string searchInput;
-    std::vector<size_t> searchMatches;
-    size_t currentMatchIndex;
+    SearchEngine searchEngine;
+    size_t nextMatchFrom;       // Enter looks for the next match from here
     
     // ========================================================================
     // Editing State
@@ -102,8 +100,8 @@ private:
     int64_t selectedByteIndex;
     std::string editBuffer;
     bool hasUnsavedChanges;
-    std::set<size_t> modifiedBytes;
-    std::vector<EditAction> undoStack;
+    DirtyBitmap modifiedBytes;  // bytes that differ from the saved state
+    EditJournal editJournal;    // undo/redo history
     bool overwriteMode;
 
     // ========================================================================
@@ -122,13 +120,42 @@ private:
     // Auto-scroll during selection
     int autoScrollDirection;  // -1 = up, 0 = none, 1 = down
     float autoScrollTimer;
+    
+    // ========================================================================
+    // Row Render Cache
+    // ========================================================================
+    // Everything besides the bytes themselves that changes how a row looks;
+    // bit i stands for byte i of the row
+    struct RowHighlight {
+        uint16_t selected = 0;
+        uint16_t searched = 0;
+        uint16_t modified = 0;
+        
+        bool operator==(const RowHighlight& other) const {
+            return selected == other.selected && searched == other.searched &&
+                   modified == other.modified;
+        }
+    };
+    
+    struct CachedRow {
+        SDL_Texture* texture;
+        RowHighlight highlight;
+    };
+    
+    // Rendered rows keyed by row index. The whole cache is dropped when the
+    // zoom, encoding or row size changes; edits drop single rows.
+    std::unordered_map<size_t, CachedRow> rowCache;
+    float rowCacheZoom;
+    TextEncoding rowCacheEncoding;
+    int rowCacheWidth;
+    int rowCacheHeight;
 
     // ========================================================================
     // Layout Methods
     // ========================================================================
     void recalculateLayoutForZoom();
     int getByteXPosition(int byteInRow) const;
-    int getByteIndexFromPosition(int x, int y) const;
+    int64_t getByteIndexFromPosition(int x, int y) const;
     bool isJapaneseEncoding() const;
     
     // ========================================================================
@@ -143,6 +170,14 @@ private:
     // ========================================================================
     void scrollToAddress(size_t address);
     void selectByte(int64_t index);
+    void gotoModifiedByte(bool forward);
+    
+    // ========================================================================
+    // Dirty Regions
+    // ========================================================================
+    SDL_Rect getRowRect(size_t row) const;    // empty when scrolled out of view
+    void markByteDirty(size_t index);
+    void markHeaderDirty();
     
     // ========================================================================
     // Selection Methods
@@ -157,7 +192,9 @@ private:
     void commitEdit();
     void handleEditInput(char c);
     void undoLastEdit();
-    void updateModifiedState(size_t index);
+    void redoLastEdit();
+    void writeBytes(size_t offset, const char* bytes, size_t length);
+    void updateModifiedState(size_t index, size_t length = 1);
     
     // ========================================================================
     // File Operations
@@ -172,6 +209,7 @@ private:
     // ========================================================================
     void handleCopy();
     void handlePaste();
+    void pasteHexBytes(const std::string& text);
     void appendHexInput(const std::string& text);
     
     // ========================================================================
@@ -180,12 +218,6 @@ private:
     void updateSearchMatches();
     void gotoNextMatch();
     
-    // ========================================================================
-    // Text Analysis
-    // ========================================================================
-    bool containsJapaneseCharacters(const std::string& text) const;
-    size_t getVisualCellCount(const std::string& text) const;
-    
     // ========================================================================
     // Event Handlers
     // ========================================================================
@@ -204,12 +236,22 @@ private:
     // ========================================================================
     void renderHeader();
     void renderDecodedContent(int y, size_t address, size_t bytesInRow);
+    void renderRow(int y, size_t row, const RowHighlight& highlight);
+    bool renderCachedRow(int y, size_t row, const RowHighlight& highlight);
+    RowHighlight getRowHighlight(size_t row, int64_t selStart, int64_t selEnd,
+                                 const SearchResults* search) const;
+    uint16_t getSearchMask(size_t row, const SearchResults& search) const;
+    void invalidateRow(size_t row);
+    void invalidateRange(size_t offset, size_t length);
+    void clearRowCache();
+    void evictDistantRows();
     
 protected:
     // ========================================================================
     // SDLAppBase Overrides
     // ========================================================================
     void render() override;
+    bool isAnimating() const override;
     void handleEvent(SDL_Event& event) override;
     void onResize(int newWidth, int newHeight) override;
     void update(float deltaTime) override;
@@ -219,6 +261,7 @@ public:
     // Public Interface
     // ========================================================================
     HexEditor();
+    ~HexEditor() override;
     
     // File operations
     bool loadFile(const char* filename);
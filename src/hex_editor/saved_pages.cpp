@@ -0,0 +1,40 @@
+#include "saved_pages.h"
+#include <algorithm>
+#include <cstring>
+
+void SavedPages::reset(size_t size) {
+    bufferSize = size;
+    pages.clear();
+    pages.resize((size + PAGE_SIZE - 1) / PAGE_SIZE);
+    keptCount = 0;
+}
+
+void SavedPages::clear() {
+    for (auto& page : pages) {
+        page.reset();
+    }
+    keptCount = 0;
+}
+
+void SavedPages::preserve(const char* buffer, size_t offset, size_t length) {
+    if (length == 0 || offset >= bufferSize) return;
+    size_t end = std::min(offset + length, bufferSize);
+
+    for (size_t page = offset / PAGE_SIZE; page <= (end - 1) / PAGE_SIZE; page++) {
+        if (pages[page]) continue;
+
+        // The last page may be short; its tail is never compared
+        size_t start = page * PAGE_SIZE;
+        size_t bytes = std::min(PAGE_SIZE, bufferSize - start);
+        pages[page].reset(new char[PAGE_SIZE]);
+        std::memcpy(pages[page].get(), buffer + start, bytes);
+        keptCount++;
+    }
+}
+
+void SavedPages::release(size_t page) {
+    if (page < pages.size() && pages[page]) {
+        pages[page].reset();
+        keptCount--;
+    }
+}
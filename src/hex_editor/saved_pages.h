@@ -0,0 +1,46 @@
+#ifndef SAVED_PAGES_H
+#define SAVED_PAGES_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// ============================================================================
+// Saved Pages
+// ============================================================================
+// The last saved contents of a buffer, kept only for the pages edited since
+// then. A page is copied right before its first write, so an unedited file
+// costs one pointer per 4KB page instead of a second full copy.
+
+class SavedPages {
+public:
+    static constexpr size_t PAGE_SIZE = 4096;
+
+    // Forgets every page and sizes the map for a `size`-byte buffer
+    void reset(size_t size);
+
+    // The buffer's current contents become the saved state
+    void clear();
+
+    // Copies each page overlapping [offset, offset + length) from buffer,
+    // unless it is already kept. Call before writing to the range.
+    void preserve(const char* buffer, size_t offset, size_t length);
+
+    // Drops a page whose bytes all match the saved state again
+    void release(size_t page);
+
+    // Whether buffer[index] differs from the saved byte
+    bool differs(const char* buffer, size_t index) const {
+        const char* page = pages[index / PAGE_SIZE].get();
+        return page && page[index % PAGE_SIZE] != buffer[index];
+    }
+
+    size_t keptPages() const { return keptCount; }
+
+private:
+    std::vector<std::unique_ptr<char[]>> pages;
+    size_t bufferSize = 0;
+    size_t keptCount = 0;
+};
+
+#endif // SAVED_PAGES_H
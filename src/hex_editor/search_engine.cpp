@@ -0,0 +1,149 @@
+#include "search_engine.h"
+#include "../common/search_kernels.h"
+#include <algorithm>
+#include <cstring>
+
+// ============================================================================
+// Lifetime
+// ============================================================================
+
+SearchEngine::~SearchEngine() {
+    cancel();
+}
+
+void SearchEngine::join() {
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void SearchEngine::cancel() {
+    if (!worker.joinable()) return;
+    cancelRequested.store(true, std::memory_order_relaxed);
+    join();
+    cancelRequested.store(false, std::memory_order_relaxed);
+    pending = SearchResults{};
+}
+
+void SearchEngine::reset() {
+    cancel();
+    current = SearchResults{};
+}
+
+// ============================================================================
+// Starting and Collecting Searches
+// ============================================================================
+
+void SearchEngine::start(const uint8_t* data, size_t size, std::vector<uint8_t> pattern) {
+    cancel();
+
+    // Every match of the longer pattern is a match of its prefix, so a
+    // finished search that stored all its matches can be narrowed down
+    bool refinable = current.complete && current.allStored() &&
+                     !current.pattern.empty() && pattern.size() > current.pattern.size() &&
+                     std::equal(current.pattern.begin(), current.pattern.end(), pattern.begin());
+
+    pending = SearchResults{};
+    pending.pattern = std::move(pattern);
+    if (refinable) {
+        pending.matches = std::move(current.matches);
+    }
+
+    // Nothing is shown until the new search finishes
+    current = SearchResults{};
+    current.pattern = pending.pattern;
+
+    if (pending.pattern.empty() || pending.pattern.size() > size) {
+        pending.matches.clear();
+        pending.complete = true;
+        std::swap(current, pending);
+        return;
+    }
+
+    workDone.store(0, std::memory_order_relaxed);
+    workTotal = refinable ? pending.matches.size() : size;
+    running.store(true, std::memory_order_release);
+
+    worker = std::thread([this, data, size, refinable]() {
+        if (refinable) {
+            refine(data, size);
+        } else {
+            scan(data, size);
+        }
+        running.store(false, std::memory_order_release);
+    });
+}
+
+bool SearchEngine::poll() {
+    if (!worker.joinable() || isRunning()) return false;
+    join();
+
+    // Only cancel() stops a worker early, and it discards what was found
+    std::swap(current, pending);
+    pending = SearchResults{};
+    return true;
+}
+
+float SearchEngine::progress() const {
+    if (!isRunning() || workTotal == 0) return current.complete ? 1.0f : 0.0f;
+    return static_cast<float>(workDone.load(std::memory_order_relaxed)) /
+           static_cast<float>(workTotal);
+}
+
+// ============================================================================
+// Worker
+// ============================================================================
+
+void SearchEngine::scan(const uint8_t* data, size_t size) {
+    const uint8_t* pattern = pending.pattern.data();
+    const size_t length = pending.pattern.size();
+    const size_t lastStart = size - length;
+
+    // Chunks overlap by length - 1 bytes so matches across a boundary are
+    // found exactly once, by the chunk they start in
+    for (size_t chunkStart = 0; chunkStart <= lastStart; chunkStart += CHUNK_SIZE) {
+        if (cancelRequested.load(std::memory_order_relaxed)) return;
+
+        size_t chunkStarts = std::min(CHUNK_SIZE, lastStart - chunkStart + 1);
+        size_t chunkBytes = chunkStarts + length - 1;
+        const uint8_t* chunk = data + chunkStart;
+
+        size_t offset = 0;
+        while (offset < chunkStarts) {
+            size_t hit = SearchKernels::find(chunk + offset, chunkBytes - offset, pattern, length);
+            if (hit == SearchKernels::NOT_FOUND) break;
+
+            offset += hit;
+            if (pending.matches.size() < MAX_STORED_MATCHES) {
+                pending.matches.push_back(chunkStart + offset);
+            }
+            pending.matchCount++;
+            offset++;
+        }
+        workDone.store(chunkStart + chunkStarts, std::memory_order_relaxed);
+    }
+    pending.complete = true;
+}
+
+void SearchEngine::refine(const uint8_t* data, size_t size) {
+    const uint8_t* pattern = pending.pattern.data();
+    const size_t length = pending.pattern.size();
+    std::vector<size_t>& matches = pending.matches;
+
+    // Compacts the surviving matches to the front, keeping their order
+    size_t kept = 0;
+    for (size_t i = 0; i < matches.size(); i++) {
+        if (i % REFINE_BATCH == 0) {
+            if (cancelRequested.load(std::memory_order_relaxed)) return;
+            workDone.store(i, std::memory_order_relaxed);
+        }
+
+        size_t address = matches[i];
+        if (address + length <= size && std::memcmp(data + address, pattern, length) == 0) {
+            matches[kept++] = address;
+        }
+    }
+    matches.resize(kept);
+    pending.matchCount = kept;
+    pending.complete = true;
+}
@@ -0,0 +1,86 @@
+#ifndef SEARCH_ENGINE_H
+#define SEARCH_ENGINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// Search Results
+// ============================================================================
+
+struct SearchResults {
+    std::vector<uint8_t> pattern;
+    std::vector<size_t> matches;    // ascending; at most MAX_STORED_MATCHES
+    size_t matchCount = 0;          // every match, including ones not stored
+    bool complete = false;          // false while searching or after a cancel
+
+    bool allStored() const { return matches.size() == matchCount; }
+};
+
+// ============================================================================
+// Search Engine
+// ============================================================================
+// Runs byte-pattern searches on a background thread so typing a query never
+// blocks the UI. Starting a new search cancels the one in progress. When the
+// new pattern extends the pattern of the last finished search, only that
+// search's matches are re-checked instead of scanning the whole buffer
+// again, which is the common case while a query is being typed.
+//
+// The worker only reads the buffer. Callers must reset() before changing
+// it, which also keeps stale matches from being refined.
+
+class SearchEngine {
+public:
+    static constexpr size_t MAX_STORED_MATCHES = size_t{1} << 20;
+
+    SearchEngine() = default;
+    ~SearchEngine();
+
+    SearchEngine(const SearchEngine&) = delete;
+    SearchEngine& operator=(const SearchEngine&) = delete;
+
+    void start(const uint8_t* data, size_t size, std::vector<uint8_t> pattern);
+
+    // Stops the search in progress, if any, and waits for the worker
+    void cancel();
+
+    // Cancels and forgets the last results
+    void reset();
+
+    // Picks up the worker's results once it has finished. Returns true when
+    // results() changed.
+    bool poll();
+
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+
+    // True from start() until poll() has collected the results, so callers
+    // know to keep polling
+    bool isActive() const { return worker.joinable(); }
+
+    // 0..1 share of the current search done so far
+    float progress() const;
+
+    const SearchResults& results() const { return current; }
+
+private:
+    static constexpr size_t CHUNK_SIZE = 1 << 20;   // bytes scanned between cancel checks
+    static constexpr size_t REFINE_BATCH = 1 << 16; // matches re-checked between cancel checks
+
+    std::thread worker;
+    std::atomic<bool> running{false};
+    std::atomic<bool> cancelRequested{false};
+    std::atomic<size_t> workDone{0};
+    size_t workTotal = 0;
+
+    SearchResults current;  // owned by the caller's thread
+    SearchResults pending;  // owned by the worker until it finishes
+
+    void join();
+    void scan(const uint8_t* data, size_t size);
+    void refine(const uint8_t* data, size_t size);
+};
+
+#endif // SEARCH_ENGINE_H
@@ -285,14 +285,15 @@ int main(int argc, char** argv) {
             editor.applyBatchEdits(edits);
             editor.runBatchSaveMode();
         } else {
-            std::string fileBuffer;
+            MappedFile fileBuffer;
             size_t fileSize;
             
-            if (!HexUtils::loadFileToBuffer(filename, fileBuffer, fileSize)) {
+            if (!HexUtils::loadFileToBuffer(filename, fileBuffer, fileSize, MappedFile::Mode::CopyOnWrite)) {
                 std::cerr << "Failed to open: " << filename << std::endl;
                 return 1;
             }
             
+            PatchList patches;
             for (const auto& edit : edits) {
                 size_t addr = edit.first;
                 const std::vector<unsigned char>& bytes = edit.second;
@@ -300,6 +301,7 @@ int main(int argc, char** argv) {
                 for (size_t j = 0; j < bytes.size(); j++) {
                     if (addr + j < fileSize) {
                         fileBuffer[addr + j] = (char)bytes[j];
+                        patches.add(addr + j, 1);
                     } else {
                         std::cerr << "Warning: Address 0x" << HexUtils::toHexString(addr + j, 8)
                                   << " is beyond file size (" << fileSize << " bytes)" << std::endl;
@@ -311,15 +313,11 @@ int main(int argc, char** argv) {
                 MKDIR("edited_files");
             }
             
-            std::ofstream outFile(outputPath, std::ios::binary);
-            if (!outFile) {
+            if (!PatchWriter::save(filename, outputPath, fileBuffer, fileSize, patches)) {
                 std::cerr << "Failed to save: " << outputPath << std::endl;
                 return 1;
             }
             
-            outFile.write(fileBuffer.data(), fileSize);
-            outFile.close();
-            
             std::cout << "Saved to: " << outputPath << std::endl;
         }
         
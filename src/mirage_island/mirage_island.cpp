@@ -1,4 +1,5 @@
 #include "mirage_island.h"
+#include "../common/game_detect.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -60,12 +61,14 @@ uint32_t MirageIslandEditor::readU32LE(size_t offset) const {
     return DataUtils::readU32LE(fileBuffer, offset);
 }
 
-void MirageIslandEditor::writeU8(std::string& buffer, size_t offset, uint8_t value) {
-    DataUtils::writeU8(buffer, offset, value);
+void MirageIslandEditor::writeU8(size_t offset, uint8_t value) {
+    DataUtils::writeU8(fileBuffer, offset, value);
+    filePatches.add(offset, 1);
 }
 
-void MirageIslandEditor::writeU16LE(std::string& buffer, size_t offset, uint16_t value) {
-    DataUtils::writeU16LE(buffer, offset, value);
+void MirageIslandEditor::writeU16LE(size_t offset, uint16_t value) {
+    DataUtils::writeU16LE(fileBuffer, offset, value);
+    filePatches.add(offset, 2);
 }
 
 // ============================================================================
@@ -110,6 +113,18 @@ bool MirageIslandEditor::setGame(const std::string& game) {
     std::string g = game;
     std::transform(g.begin(), g.end(), g.begin(), ::tolower);
     
+    if (g == GameDetect::AUTO_GAME) {
+        GameDetect::Result detected = GameDetect::detect(fileBuffer);
+        if (!detected.found()) {
+            gameMode = MIRAGE_GAME_INVALID;
+            errorMessage = "Could not detect the game; pass it explicitly";
+            std::cerr << "Error: " << errorMessage << std::endl;
+            return false;
+        }
+        std::cout << "Detected game: " << detected.description << std::endl;
+        return setGame(detected.game);
+    }
+    
     if (g == "ruby" || g == "pokemon_ruby") {
         gameMode = MIRAGE_GAME_RUBY_SAPPHIRE;
         gameName = "Pokemon Ruby";
@@ -189,8 +204,8 @@ bool MirageIslandEditor::performMirageIslandEdit() {
               << " " << HexUtils::toHexString((originalMirageValue >> 8) & 0xFF, 2) << ")" << std::endl;
     
     newMirageValue = static_cast<uint16_t>(pidByte1) | (static_cast<uint16_t>(pidByte2) << 8);
-    writeU8(fileBuffer, mirageIslandOffset, pidByte1);
-    writeU8(fileBuffer, mirageIslandOffset + 1, pidByte2);
+    writeU8(mirageIslandOffset, pidByte1);
+    writeU8(mirageIslandOffset + 1, pidByte2);
     
     std::cout << "New Mirage Island value: 0x" << HexUtils::toHexString(newMirageValue, 4)
               << " (bytes: " << HexUtils::toHexString(pidByte1, 2) 
@@ -207,7 +222,7 @@ bool MirageIslandEditor::performMirageIslandEdit() {
     std::cout << "New checksum: 0x" << HexUtils::toHexString(newChecksum, 4)
               << " (bytes: " << formatReversedBytes16(newChecksum) << ")" << std::endl;
     
-    writeU16LE(fileBuffer, checksumOffset, newChecksum);
+    writeU16LE(checksumOffset, newChecksum);
     
     return true;
 }
@@ -237,16 +252,12 @@ bool MirageIslandEditor::writeToFile() {
         outputFilePath = "edited_files/" + nameWithoutExt + "_mirage" + extension;
     }
     
-    std::ofstream outFile(outputFilePath, std::ios::binary);
-    if (!outFile) {
+    if (!PatchWriter::save(fileName, outputFilePath, fileBuffer, fileSize, filePatches)) {
         errorMessage = "Failed to create output file: " + outputFilePath;
         std::cerr << errorMessage << std::endl;
         return false;
     }
     
-    outFile.write(fileBuffer.c_str(), static_cast<std::streamsize>(fileSize));
-    outFile.close();
-    
     if (shouldOverwrite) {
         std::cout << "\nMirage Island edit complete (file overwritten): " << outputFilePath << std::endl;
     } else {
@@ -324,9 +335,7 @@ void MirageIslandEditor::update(float deltaTime) {
 // ============================================================================
 
 void MirageIslandEditor::render() {
-    SDL_SetRenderDrawColor(renderer, colors.background.r, colors.background.g, 
-                          colors.background.b, 255);
-    SDL_RenderClear(renderer);
+    clearDirtyRegions(colors.background);
     
     int y = 15;
     std::stringstream ss;
@@ -351,7 +360,6 @@ void MirageIslandEditor::render() {
         y += 55;
         renderCenteredText(errorMessage, y, colors.error);
         renderCenteredText("Press ESC or Q to quit", windowHeight - charHeight - 15, colors.textDim);
-        SDL_RenderPresent(renderer);
         return;
     }
     
@@ -458,6 +466,4 @@ void MirageIslandEditor::render() {
     }
     
     renderCenteredText("Press ESC or Q to quit", windowHeight - charHeight - 15, colors.textDim);
-    
-    SDL_RenderPresent(renderer);
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "../common/hex_utils.h"
 #include "../common/data_utils.h"
 #include "../common/generation3_utils.h"
+#include "../common/patch_writer.h"
 #include <vector>
 #include <cstdint>
 #include <string>
@@ -21,6 +22,7 @@ private:
     std::string fileBuffer;
     std::string fileName;
     size_t fileSize;
+    PatchList filePatches;  // bytes of fileBuffer changed by the edit
     
     // Game mode
     MirageIslandGame gameMode;
@@ -59,8 +61,10 @@ private:
     uint8_t readU8(size_t offset) const;
     uint16_t readU16LE(size_t offset) const;
     uint32_t readU32LE(size_t offset) const;
-    void writeU8(std::string& buffer, size_t offset, uint8_t value);
-    void writeU16LE(std::string& buffer, size_t offset, uint16_t value);
+    
+    // Write into fileBuffer and record the bytes in filePatches
+    void writeU8(size_t offset, uint8_t value);
+    void writeU16LE(size_t offset, uint16_t value);
     
     // Section handling
     void parseSaveBlock(size_t blockBaseAddr, Generation3Utils::SectionInfo* sections, uint32_t& saveIndex);
@@ -13,6 +13,7 @@ void printUsage(const char* progName) {
     std::cerr << "  -o            Overwrite original file (default: saves to edited_files/)" << std::endl;
     std::cerr << "\nSupported games:" << std::endl;
     std::cerr << "  ruby, sapphire, emerald - Pokemon Ruby/Sapphire/Emerald (GBA)" << std::endl;
+    std::cerr << "  auto                    - Detect the game from the save" << std::endl;
     std::cerr << "\nNote: Mirage Island only exists in Pokemon Ruby, Sapphire, and Emerald." << std::endl;
     std::cerr << "\nExamples:" << std::endl;
     std::cerr << "  " << progName << " PokemonEmerald.sav emerald" << std::endl;
@@ -1,4 +1,5 @@
 #include "pokemon_bag.h"
+#include "../common/game_detect.h"
 
 #include <fstream>
 #include <sstream>
@@ -47,6 +48,17 @@ bool PokemonBagEditor::isGen3Game() const {
            gameType == GameType::FIRERED_LEAFGREEN;
 }
 
+GameLayouts::Layout PokemonBagEditor::layoutFor(GameType type, bool japanese) {
+    switch (type) {
+        case GameType::GOLD_SILVER:       return GameLayouts::layoutOf(GameLayouts::Game::GOLD_SILVER, japanese);
+        case GameType::CRYSTAL:           return GameLayouts::layoutOf(GameLayouts::Game::CRYSTAL, japanese);
+        case GameType::RUBY_SAPPHIRE:     return GameLayouts::Layout::RUBY_SAPPHIRE;
+        case GameType::EMERALD:           return GameLayouts::Layout::EMERALD;
+        case GameType::FIRERED_LEAFGREEN: return GameLayouts::Layout::FIRERED_LEAFGREEN;
+        default:                          return GameLayouts::layoutOf(GameLayouts::Game::GEN1, japanese);
+    }
+}
+
 bool PokemonBagEditor::findGen3CurrentSave() {
     if (fileSize < Generation3Utils::GEN3_SAVE_SIZE) {
         std::cerr << "File too small for Gen 3 save" << std::endl;
@@ -172,6 +184,7 @@ void PokemonBagEditor::writeGen3PocketToBuffer(const PocketInfo& pocket) {
         
         DataUtils::writeU16LE(fileBuffer, itemOffset, itemId);
         DataUtils::writeU16LE(fileBuffer, itemOffset + 2, encryptedQty);
+        filePatches.add(itemOffset, 4);
     }
 }
 
@@ -185,6 +198,7 @@ void PokemonBagEditor::updateChecksumGen3() {
     
     DataUtils::writeU16LE(fileBuffer, 
         sectionBase + Generation3Utils::GEN3_SECTION_CHECKSUM_OFFSET, checksum);
+    filePatches.add(sectionBase + Generation3Utils::GEN3_SECTION_CHECKSUM_OFFSET, 2);
 }
 
 // ============================================================================
@@ -201,6 +215,17 @@ bool PokemonBagEditor::setGame(const std::string& game) {
     gameType = GameType::UNKNOWN;
     gameName.clear();
     
+    if (g == GameDetect::AUTO_GAME) {
+        GameDetect::Result detected = GameDetect::detect(fileBuffer);
+        if (!detected.found()) {
+            std::cerr << "Could not detect the game of " << fileName << "; pass it explicitly" << std::endl;
+            return false;
+        }
+        std::cout << "Detected game: " << detected.description << (detected.japanese ? " (Japanese)" : "") << std::endl;
+        isJapanese = detected.japanese;
+        return setGame(detected.game);
+    }
+    
     // Determine game type
     if (g == "red" || g == "blue" || g == "yellow" || g == "green" ||
         g == "pokemon_red" || g == "pokemon_blue" || g == "pokemon_yellow" || 
@@ -241,7 +266,7 @@ bool PokemonBagEditor::setGame(const std::string& game) {
     } else {
         std::cerr << "Unknown game: " << game << std::endl;
         std::cerr << "Supported games: red, blue, yellow, green, gold, silver, crystal, "
-                  << "ruby, sapphire, emerald, firered, leafgreen" << std::endl;
+                  << "ruby, sapphire, emerald, firered, leafgreen, auto" << std::endl;
         return false;
     }
 
@@ -250,6 +275,8 @@ bool PokemonBagEditor::setGame(const std::string& game) {
         gameName += " (Japanese)";
     }
 
+    const GameLayouts::GameLayout& layout = GameLayouts::get(layoutFor(gameType, isJapanese));
+
     // Build pocket definitions based on game type and language
     pockets.clear();
     currentPocket = 0;
@@ -269,441 +296,22 @@ bool PokemonBagEditor::setGame(const std::string& game) {
         }
     }
 
-    // For Gen1, there is a single bag
-    if (gameType == GameType::GEN1) {
+    // Gen 1 has a single bag; Gen 2 keeps a backup copy of every pocket;
+    // Gen 3 pocket offsets are relative to Section 1
+    for (size_t i = 0; i < layout.pocketCount; i++) {
+        const GameLayouts::Pocket& def = layout.pockets[i];
         PocketInfo p;
-        p.name = "Items";
-        p.capacity = 20;
-        p.hasQuantity = true;
-        p.idStored = true;
-        p.idEditable = true;
-        p.quantityEditable = true;
-        p.nameEditable = true;
-        p.primaryOffset = isJapanese ? 0x25C4 : 0x25C9;
-        p.secondaryOffset = 0; // Gen 1 has only one copy
+        p.name = def.name;
+        p.capacity = def.capacity;
+        p.hasQuantity = def.hasQuantity;
+        p.idStored = def.idStored;
+        p.idEditable = def.idEditable;
+        p.quantityEditable = def.quantityEditable;
+        p.nameEditable = def.nameEditable;
+        p.primaryOffset = def.primaryOffset;
+        p.secondaryOffset = def.secondaryOffset;
         p.slots.assign(p.capacity, BagSlot{});
         pockets.push_back(p);
-    } else if (gameType == GameType::GOLD_SILVER) {
-        // Generation 2 Gold/Silver pockets
-        if (isJapanese) {
-            // Japanese GS
-            PocketInfo tm;
-            tm.name = "TMs/HMs";
-            tm.capacity = 57;
-            tm.hasQuantity = true;
-            tm.idStored = false;
-            tm.idEditable = false;
-            tm.quantityEditable = true;
-            tm.nameEditable = false;
-            tm.primaryOffset = 0x23C7;
-            tm.secondaryOffset = 0x75C7;
-            tm.slots.assign(tm.capacity, BagSlot{});
-            pockets.push_back(tm);
-
-            PocketInfo items;
-            items.name = "Items";
-            items.capacity = 20;
-            items.hasQuantity = true;
-            items.idStored = true;
-            items.idEditable = true;
-            items.quantityEditable = true;
-            items.nameEditable = true;
-            items.primaryOffset = 0x2400;
-            items.secondaryOffset = 0x7600;
-            items.slots.assign(items.capacity, BagSlot{});
-            pockets.push_back(items);
-
-            PocketInfo keys;
-            keys.name = "Key Items";
-            keys.capacity = 26;
-            keys.hasQuantity = false;
-            keys.idStored = true;
-            keys.idEditable = true;
-            keys.quantityEditable = false;
-            keys.nameEditable = true;
-            keys.primaryOffset = 0x242A;
-            keys.secondaryOffset = 0x762A;
-            keys.slots.assign(keys.capacity, BagSlot{});
-            pockets.push_back(keys);
-
-            PocketInfo balls;
-            balls.name = "Balls";
-            balls.capacity = 12;
-            balls.hasQuantity = true;
-            balls.idStored = true;
-            balls.idEditable = true;
-            balls.quantityEditable = true;
-            balls.nameEditable = true;
-            balls.primaryOffset = 0x2445;
-            balls.secondaryOffset = 0x7645;
-            balls.slots.assign(balls.capacity, BagSlot{});
-            pockets.push_back(balls);
-        } else {
-            // English GS
-            PocketInfo tm;
-            tm.name = "TMs/HMs";
-            tm.capacity = 57;
-            tm.hasQuantity = true;
-            tm.idStored = false;
-            tm.idEditable = false;
-            tm.quantityEditable = true;
-            tm.nameEditable = false;
-            tm.primaryOffset = 0x23E6;
-            tm.secondaryOffset = 0x0C78;
-            tm.slots.assign(tm.capacity, BagSlot{});
-            pockets.push_back(tm);
-
-            PocketInfo items;
-            items.name = "Items";
-            items.capacity = 20;
-            items.hasQuantity = true;
-            items.idStored = true;
-            items.idEditable = true;
-            items.quantityEditable = true;
-            items.nameEditable = true;
-            items.primaryOffset = 0x241F;
-            items.secondaryOffset = 0x0CB1;
-            items.slots.assign(items.capacity, BagSlot{});
-            pockets.push_back(items);
-
-            PocketInfo keys;
-            keys.name = "Key Items";
-            keys.capacity = 26;
-            keys.hasQuantity = false;
-            keys.idStored = true;
-            keys.idEditable = true;
-            keys.quantityEditable = false;
-            keys.nameEditable = true;
-            keys.primaryOffset = 0x2449;
-            keys.secondaryOffset = 0x0CDB;
-            keys.slots.assign(keys.capacity, BagSlot{});
-            pockets.push_back(keys);
-
-            PocketInfo balls;
-            balls.name = "Balls";
-            balls.capacity = 12;
-            balls.hasQuantity = true;
-            balls.idStored = true;
-            balls.idEditable = true;
-            balls.quantityEditable = true;
-            balls.nameEditable = true;
-            balls.primaryOffset = 0x2464;
-            balls.secondaryOffset = 0x0CF6;
-            balls.slots.assign(balls.capacity, BagSlot{});
-            pockets.push_back(balls);
-        }
-    } else if (gameType == GameType::CRYSTAL) {
-        // Generation 2 Crystal pockets
-        if (isJapanese) {
-            PocketInfo tm;
-            tm.name = "TMs/HMs";
-            tm.capacity = 57;
-            tm.hasQuantity = true;
-            tm.idStored = false;
-            tm.idEditable = false;
-            tm.quantityEditable = true;
-            tm.nameEditable = false;
-            tm.primaryOffset = 0x23C9;
-            tm.secondaryOffset = 0x75C9;
-            tm.slots.assign(tm.capacity, BagSlot{});
-            pockets.push_back(tm);
-
-            PocketInfo items;
-            items.name = "Items";
-            items.capacity = 20;
-            items.hasQuantity = true;
-            items.idStored = true;
-            items.idEditable = true;
-            items.quantityEditable = true;
-            items.nameEditable = true;
-            items.primaryOffset = 0x2402;
-            items.secondaryOffset = 0x7602;
-            items.slots.assign(items.capacity, BagSlot{});
-            pockets.push_back(items);
-
-            PocketInfo keys;
-            keys.name = "Key Items";
-            keys.capacity = 26;
-            keys.hasQuantity = false;
-            keys.idStored = true;
-            keys.idEditable = true;
-            keys.quantityEditable = false;
-            keys.nameEditable = true;
-            keys.primaryOffset = 0x242C;
-            keys.secondaryOffset = 0x762C;
-            keys.slots.assign(keys.capacity, BagSlot{});
-            pockets.push_back(keys);
-
-            PocketInfo balls;
-            balls.name = "Balls";
-            balls.capacity = 12;
-            balls.hasQuantity = true;
-            balls.idStored = true;
-            balls.idEditable = true;
-            balls.quantityEditable = true;
-            balls.nameEditable = true;
-            balls.primaryOffset = 0x2447;
-            balls.secondaryOffset = 0x7647;
-            balls.slots.assign(balls.capacity, BagSlot{});
-            pockets.push_back(balls);
-        } else {
-            PocketInfo tm;
-            tm.name = "TMs/HMs";
-            tm.capacity = 57;
-            tm.hasQuantity = true;
-            tm.idStored = false;
-            tm.idEditable = false;
-            tm.quantityEditable = true;
-            tm.nameEditable = false;
-            tm.primaryOffset = 0x23E7;
-            tm.secondaryOffset = 0x15E7;
-            tm.slots.assign(tm.capacity, BagSlot{});
-            pockets.push_back(tm);
-
-            PocketInfo items;
-            items.name = "Items";
-            items.capacity = 20;
-            items.hasQuantity = true;
-            items.idStored = true;
-            items.idEditable = true;
-            items.quantityEditable = true;
-            items.nameEditable = true;
-            items.primaryOffset = 0x2420;
-            items.secondaryOffset = 0x1620;
-            items.slots.assign(items.capacity, BagSlot{});
-            pockets.push_back(items);
-
-            PocketInfo keys;
-            keys.name = "Key Items";
-            keys.capacity = 26;
-            keys.hasQuantity = false;
-            keys.idStored = true;
-            keys.idEditable = true;
-            keys.quantityEditable = false;
-            keys.nameEditable = true;
-            keys.primaryOffset = 0x244A;
-            keys.secondaryOffset = 0x164A;
-            keys.slots.assign(keys.capacity, BagSlot{});
-            pockets.push_back(keys);
-
-            PocketInfo balls;
-            balls.name = "Balls";
-            balls.capacity = 12;
-            balls.hasQuantity = true;
-            balls.idStored = true;
-            balls.idEditable = true;
-            balls.quantityEditable = true;
-            balls.nameEditable = true;
-            balls.primaryOffset = 0x2465;
-            balls.secondaryOffset = 0x1665;
-            balls.slots.assign(balls.capacity, BagSlot{});
-            pockets.push_back(balls);
-        }
-    } else if (gameType == GameType::RUBY_SAPPHIRE) {
-        // Ruby/Sapphire pocket definitions
-        // Offsets are relative to Section 1
-        // Items: 20, Key Items: 20, Balls: 16, TM/HM: 64, Berries: 46
-        
-        PocketInfo items;
-        items.name = "Items";
-        items.capacity = 20;
-        items.hasQuantity = true;
-        items.idStored = true;
-        items.idEditable = true;
-        items.quantityEditable = true;
-        items.nameEditable = true;
-        items.primaryOffset = 0x0560;
-        items.secondaryOffset = 0;
-        items.slots.assign(items.capacity, BagSlot{});
-        pockets.push_back(items);
-
-        PocketInfo keys;
-        keys.name = "Key Items";
-        keys.capacity = 20;
-        keys.hasQuantity = true;
-        keys.idStored = true;
-        keys.idEditable = true;
-        keys.quantityEditable = true;
-        keys.nameEditable = true;
-        keys.primaryOffset = 0x05B0;
-        keys.secondaryOffset = 0;
-        keys.slots.assign(keys.capacity, BagSlot{});
-        pockets.push_back(keys);
-
-        PocketInfo balls;
-        balls.name = "Poke Balls";
-        balls.capacity = 16;
-        balls.hasQuantity = true;
-        balls.idStored = true;
-        balls.idEditable = true;
-        balls.quantityEditable = true;
-        balls.nameEditable = true;
-        balls.primaryOffset = 0x0600;
-        balls.secondaryOffset = 0;
-        balls.slots.assign(balls.capacity, BagSlot{});
-        pockets.push_back(balls);
-
-        PocketInfo tms;
-        tms.name = "TMs/HMs";
-        tms.capacity = 64;
-        tms.hasQuantity = true;
-        tms.idStored = true;
-        tms.idEditable = true;
-        tms.quantityEditable = true;
-        tms.nameEditable = true;
-        tms.primaryOffset = 0x0640;
-        tms.secondaryOffset = 0;
-        tms.slots.assign(tms.capacity, BagSlot{});
-        pockets.push_back(tms);
-
-        PocketInfo berries;
-        berries.name = "Berries";
-        berries.capacity = 46;
-        berries.hasQuantity = true;
-        berries.idStored = true;
-        berries.idEditable = true;
-        berries.quantityEditable = true;
-        berries.nameEditable = true;
-        berries.primaryOffset = 0x0740;
-        berries.secondaryOffset = 0;
-        berries.slots.assign(berries.capacity, BagSlot{});
-        pockets.push_back(berries);
-    } else if (gameType == GameType::EMERALD) {
-        // Emerald pocket definitions
-        // Items: 30, Key Items: 30, Balls: 16, TM/HM: 64, Berries: 46
-        
-        PocketInfo items;
-        items.name = "Items";
-        items.capacity = 30;
-        items.hasQuantity = true;
-        items.idStored = true;
-        items.idEditable = true;
-        items.quantityEditable = true;
-        items.nameEditable = true;
-        items.primaryOffset = 0x0560;
-        items.secondaryOffset = 0;
-        items.slots.assign(items.capacity, BagSlot{});
-        pockets.push_back(items);
-
-        PocketInfo keys;
-        keys.name = "Key Items";
-        keys.capacity = 30;
-        keys.hasQuantity = true;
-        keys.idStored = true;
-        keys.idEditable = true;
-        keys.quantityEditable = true;
-        keys.nameEditable = true;
-        keys.primaryOffset = 0x05D8;
-        keys.secondaryOffset = 0;
-        keys.slots.assign(keys.capacity, BagSlot{});
-        pockets.push_back(keys);
-
-        PocketInfo balls;
-        balls.name = "Poke Balls";
-        balls.capacity = 16;
-        balls.hasQuantity = true;
-        balls.idStored = true;
-        balls.idEditable = true;
-        balls.quantityEditable = true;
-        balls.nameEditable = true;
-        balls.primaryOffset = 0x0650;
-        balls.secondaryOffset = 0;
-        balls.slots.assign(balls.capacity, BagSlot{});
-        pockets.push_back(balls);
-
-        PocketInfo tms;
-        tms.name = "TMs/HMs";
-        tms.capacity = 64;
-        tms.hasQuantity = true;
-        tms.idStored = true;
-        tms.idEditable = true;
-        tms.quantityEditable = true;
-        tms.nameEditable = true;
-        tms.primaryOffset = 0x0690;
-        tms.secondaryOffset = 0;
-        tms.slots.assign(tms.capacity, BagSlot{});
-        pockets.push_back(tms);
-
-        PocketInfo berries;
-        berries.name = "Berries";
-        berries.capacity = 46;
-        berries.hasQuantity = true;
-        berries.idStored = true;
-        berries.idEditable = true;
-        berries.quantityEditable = true;
-        berries.nameEditable = true;
-        berries.primaryOffset = 0x0790;
-        berries.secondaryOffset = 0;
-        berries.slots.assign(berries.capacity, BagSlot{});
-        pockets.push_back(berries);
-    } else if (gameType == GameType::FIRERED_LEAFGREEN) {
-        // FireRed/LeafGreen pocket definitions
-        // Items: 42, Key Items: 30, Balls: 13, TM/HM: 58, Berries: 43
-        
-        PocketInfo items;
-        items.name = "Items";
-        items.capacity = 42;
-        items.hasQuantity = true;
-        items.idStored = true;
-        items.idEditable = true;
-        items.quantityEditable = true;
-        items.nameEditable = true;
-        items.primaryOffset = 0x0310;
-        items.secondaryOffset = 0;
-        items.slots.assign(items.capacity, BagSlot{});
-        pockets.push_back(items);
-
-        PocketInfo keys;
-        keys.name = "Key Items";
-        keys.capacity = 30;
-        keys.hasQuantity = true;
-        keys.idStored = true;
-        keys.idEditable = true;
-        keys.quantityEditable = true;
-        keys.nameEditable = true;
-        keys.primaryOffset = 0x03B8;
-        keys.secondaryOffset = 0;
-        keys.slots.assign(keys.capacity, BagSlot{});
-        pockets.push_back(keys);
-
-        PocketInfo balls;
-        balls.name = "Poke Balls";
-        balls.capacity = 13;
-        balls.hasQuantity = true;
-        balls.idStored = true;
-        balls.idEditable = true;
-        balls.quantityEditable = true;
-        balls.nameEditable = true;
-        balls.primaryOffset = 0x0430;
-        balls.secondaryOffset = 0;
-        balls.slots.assign(balls.capacity, BagSlot{});
-        pockets.push_back(balls);
-
-        PocketInfo tms;
-        tms.name = "TMs/HMs";
-        tms.capacity = 58;
-        tms.hasQuantity = true;
-        tms.idStored = true;
-        tms.idEditable = true;
-        tms.quantityEditable = true;
-        tms.nameEditable = true;
-        tms.primaryOffset = 0x0464;
-        tms.secondaryOffset = 0;
-        tms.slots.assign(tms.capacity, BagSlot{});
-        pockets.push_back(tms);
-
-        PocketInfo berries;
-        berries.name = "Berries";
-        berries.capacity = 43;
-        berries.hasQuantity = true;
-        berries.idStored = true;
-        berries.idEditable = true;
-        berries.quantityEditable = true;
-        berries.nameEditable = true;
-        berries.primaryOffset = 0x054C;
-        berries.secondaryOffset = 0;
-        berries.slots.assign(berries.capacity, BagSlot{});
-        pockets.push_back(berries);
     }
 
     // Now parse pockets from the file
@@ -852,6 +460,7 @@ void PokemonBagEditor::writePocketToBuffer(const PocketInfo& pocket) {
                 if (ofs < fileSize) {
                     DataUtils::writeU8(fileBuffer, ofs, 
                         static_cast<uint8_t>(pocket.slots[i].quantity));
+                    filePatches.add(ofs, 1);
                 }
             }
             return;
@@ -884,6 +493,7 @@ void PokemonBagEditor::writePocketToBuffer(const PocketInfo& pocket) {
         } else {
             endPos = baseOffset + 1 + pocket.capacity - 1;
         }
+        filePatches.add(baseOffset, endPos - baseOffset + 1);
         
         for (size_t i = 0; i < count; i++) {
             if (pocket.hasQuantity) {
@@ -925,78 +535,16 @@ void PokemonBagEditor::writePocketToBuffer(const PocketInfo& pocket) {
 // ============================================================================
 
 void PokemonBagEditor::updateChecksum() {
-    if (gameType == GameType::GEN1) {
-        updateChecksumGen1();
-    } else if (gameType == GameType::GOLD_SILVER || gameType == GameType::CRYSTAL) {
-        updateChecksumGen2();
-    } else if (isGen3Game()) {
+    if (isGen3Game()) {
         updateChecksumGen3();
+    } else if (gameType != GameType::UNKNOWN) {
+        updateChecksumGameBoy();
     }
 }
 
-void PokemonBagEditor::updateChecksumGen1() {
-    size_t start = 0x2598;
-    size_t end = isJapanese ? 0x3593 : 0x3522;
-    size_t checksumPos = isJapanese ? 0x3594 : 0x3523;
-    if (end >= fileSize || checksumPos >= fileSize) return;
-    
-    uint32_t sum = 0;
-    for (size_t i = start; i <= end && i < fileSize; i++) {
-        sum += static_cast<uint8_t>(fileBuffer[i]);
-    }
-    uint8_t checksum = static_cast<uint8_t>(~(sum & 0xFF));
-    DataUtils::writeU8(fileBuffer, checksumPos, checksum);
-}
-
-void PokemonBagEditor::updateChecksumGen2() {
-    auto update16BitChecksum = [&](uint32_t start, uint32_t end, uint32_t loc) {
-        uint32_t sum = 0;
-        for (uint32_t i = start; i <= end && i < fileSize; i++) {
-            sum += DataUtils::readU8(fileBuffer, i);
-        }
-        uint16_t checksum = sum & 0xFFFF;
-        if (loc + 1 < fileSize) {
-            DataUtils::writeU16LE(fileBuffer, loc, checksum);
-        }
-    };
-    
-    auto update16BitChecksumMulti = [&](const std::vector<std::pair<uint32_t,uint32_t>>& ranges,
-                                        uint32_t loc) {
-        uint32_t sum = 0;
-        for (const auto& range : ranges) {
-            for (uint32_t i = range.first; i <= range.second && i < fileSize; i++) {
-                sum += static_cast<uint8_t>(fileBuffer[i]);
-            }
-        }
-        uint16_t checksum = static_cast<uint16_t>(sum & 0xFFFF);
-        if (loc + 1 < fileSize) {
-            DataUtils::writeU16LE(fileBuffer, loc, checksum);
-        }
-    };
-
-    bool crystal = (gameType == GameType::CRYSTAL);
-    if (!crystal) {
-        if (isJapanese) {
-            update16BitChecksum(0x2009, 0x2C8B, 0x2D0D);
-            update16BitChecksum(0x7209, 0x7E8B, 0x7F0D);
-        } else {
-            update16BitChecksum(0x2009, 0x2D68, 0x2D69);
-            std::vector<std::pair<uint32_t,uint32_t>> ranges = {
-                {0x0C6B, 0x17EC},
-                {0x3D96, 0x3F3F},
-                {0x7E39, 0x7E6C}
-            };
-            update16BitChecksumMulti(ranges, 0x7E6D);
-        }
-    } else {
-        if (isJapanese) {
-            update16BitChecksum(0x2009, 0x2AE2, 0x2D0D);
-            update16BitChecksum(0x7209, 0x7CE2, 0x7F0D);
-        } else {
-            update16BitChecksum(0x2009, 0x2B82, 0x2D0D);
-            update16BitChecksum(0x1209, 0x1D82, 0x1F0D);
-        }
-    }
+void PokemonBagEditor::updateChecksumGameBoy() {
+    GameLayouts::writeChecksums(layoutFor(gameType, isJapanese), fileBuffer, fileSize,
+                                [&](size_t offset, size_t length) { filePatches.add(offset, length); });
 }
 
 // ============================================================================
@@ -1038,13 +586,10 @@ bool PokemonBagEditor::saveFile() {
         }
     }
     
-    std::ofstream outFile(outPath, std::ios::binary);
-    if (!outFile) {
+    if (!PatchWriter::save(fileName, outPath, fileBuffer, fileSize, filePatches)) {
         std::cerr << "Failed to save: " << outPath << std::endl;
         return false;
     }
-    outFile.write(fileBuffer.data(), static_cast<std::streamsize>(fileSize));
-    outFile.close();
     
     hasUnsavedChanges = false;
     setConfirmOnQuit(false);
@@ -1215,72 +760,34 @@ const char* PokemonBagEditor::getItemName(uint16_t id) const {
     return ItemsIndex::getGen2ItemName(static_cast<uint8_t>(id), isCrystal);
 }
 
-uint16_t PokemonBagEditor::lookupItemIdByName(const std::string& name, const PocketInfo& pocket) const {
-    std::string query = name;
-    std::transform(query.begin(), query.end(), query.begin(), [](unsigned char c) {
-        return static_cast<char>(std::toupper(c));
-    });
-    
-    if (gameType == GameType::GEN1) {
-        for (const auto& kv : ItemsIndex::GEN1_ITEMS) {
-            const char* nm = kv.second;
-            if (!nm) continue;
-            std::string nameStr(nm);
-            std::transform(nameStr.begin(), nameStr.end(), nameStr.begin(), [](unsigned char c) {
-                return static_cast<char>(std::toupper(c));
-            });
-            if (nameStr == query) {
-                return kv.first;
-            }
-        }
-        return 0;
-    }
-    
-    if (isGen3Game()) {
-        // Search Gen 3 items
-        for (const auto& kv : ItemsIndex::GEN3_ITEMS) {
-            const char* nm = kv.second.name;
-            if (!nm) continue;
-            
-            std::string nameStr(nm);
-            std::transform(nameStr.begin(), nameStr.end(), nameStr.begin(), [](unsigned char c) {
-                return static_cast<char>(std::toupper(c));
-            });
-            
-            if (nameStr == query) {
-                // Verify it's valid for this pocket and game
-                if (itemExistsForPocket(kv.first, pocket)) {
-                    return kv.first;
-                }
-            }
-        }
-        return 0;
-    }
+NameIndex::Range PokemonBagEditor::getItemNameIndex() const {
+    if (gameType == GameType::GEN1) return ItemsIndex::GEN1_ITEM_NAMES;
+    if (isGen3Game()) return ItemsIndex::GEN3_ITEM_NAMES;
+    if (gameType == GameType::CRYSTAL) return ItemsIndex::GEN2_ITEM_NAMES_CRYSTAL;
+    return ItemsIndex::GEN2_ITEM_NAMES_GS;
+}
+
+void PokemonBagEditor::updateNameSuggestions() {
+    nameSuggestionCount = 0;
+    selectedSuggestion = 0;
+    if (!editing || editingField != 2) return;
     
-    // Gen 2
-    bool isCrystal = (gameType == GameType::CRYSTAL);
-    for (const auto& kv : ItemsIndex::GEN2_ITEMS) {
-        const ItemsIndex::Gen2ItemInfo& info = kv.second;
-        const char* nm = nullptr;
-        if (isCrystal && info.nameCrystal != nullptr) {
-            nm = info.nameCrystal;
-        } else {
-            nm = info.nameGS;
-        }
-        if (!nm) continue;
-        
-        std::string nameStr(nm);
-        std::transform(nameStr.begin(), nameStr.end(), nameStr.begin(), [](unsigned char c) {
-            return static_cast<char>(std::toupper(c));
-        });
-        
-        if (nameStr == query) {
-            if (pocket.name == "Items" && info.pocket == ItemsIndex::POCKET_ITEMS) return kv.first;
-            if (pocket.name == "Balls" && info.pocket == ItemsIndex::POCKET_BALLS) return kv.first;
-            if (pocket.name == "Key Items" && info.pocket == ItemsIndex::POCKET_KEY_ITEMS) return kv.first;
+    // Only offer items that can go in the current pocket
+    const PocketInfo& pocket = pockets[currentPocket];
+    nameSuggestionCount = NameIndex::suggest(getItemNameIndex(), editBuffer, nameSuggestions.data(),
+                                             MAX_NAME_SUGGESTIONS,
+                                             [&](const NameIndex::Entry& entry) {
+                                                 return itemExistsForPocket(entry.id, pocket);
+                                             });
+}
+
+uint16_t PokemonBagEditor::lookupItemIdByName(const std::string& name, const PocketInfo& pocket) const {
+    // Several ids can share a name; take the first that fits this pocket
+    for (const NameIndex::Entry& entry : NameIndex::findAll(getItemNameIndex(), name)) {
+        if (itemExistsForPocket(entry.id, pocket)) {
+            return entry.id;
         }
     }
-    
     return 0;
 }
 
@@ -1295,6 +802,7 @@ void PokemonBagEditor::handleEditInput(SDL_Keycode key) {
     if (key == SDLK_ESCAPE) {
         editing = false;
         editBuffer.clear();
+        updateNameSuggestions();
         requestRedraw();
         return;
     }
@@ -1303,7 +811,11 @@ void PokemonBagEditor::handleEditInput(SDL_Keycode key) {
     if (editingField == 2) {
         if (key == SDLK_RETURN || key == SDLK_KP_ENTER) {
             if (!editBuffer.empty()) {
+                // A partial or misspelled name takes the highlighted completion
                 uint16_t foundId = lookupItemIdByName(editBuffer, pocket);
+                if (foundId == 0 && nameSuggestionCount > 0) {
+                    foundId = nameSuggestions[selectedSuggestion].id;
+                }
                 if (foundId != 0) {
                     pocket.slots[selectedIndex].itemId = foundId;
                     if (pocket.hasQuantity) {
@@ -1323,6 +835,7 @@ void PokemonBagEditor::handleEditInput(SDL_Keycode key) {
                         editingField = 0;
                         editBuffer.clear();
                     }
+                    updateNameSuggestions();
                     shiftCurrentPocket();
                 }
             }
@@ -1330,9 +843,30 @@ void PokemonBagEditor::handleEditInput(SDL_Keycode key) {
             return;
         }
         
+        // Up/Down pick a completion, Tab copies it into the buffer
+        if (nameSuggestionCount > 0) {
+            if (key == SDLK_DOWN) {
+                selectedSuggestion = (selectedSuggestion + 1) % nameSuggestionCount;
+                requestRedraw();
+                return;
+            }
+            if (key == SDLK_UP) {
+                selectedSuggestion = (selectedSuggestion + nameSuggestionCount - 1) % nameSuggestionCount;
+                requestRedraw();
+                return;
+            }
+            if (key == SDLK_TAB) {
+                editBuffer.assign(nameSuggestions[selectedSuggestion].name);
+                updateNameSuggestions();
+                requestRedraw();
+                return;
+            }
+        }
+        
         if (key == SDLK_BACKSPACE) {
             if (!editBuffer.empty()) {
                 editBuffer.pop_back();
+                updateNameSuggestions();
                 requestRedraw();
             }
             return;
@@ -1355,6 +889,7 @@ void PokemonBagEditor::handleEditInput(SDL_Keycode key) {
             return;
         }
         editBuffer.push_back(c);
+        updateNameSuggestions();
         requestRedraw();
         return;
     }
@@ -1470,9 +1005,7 @@ void PokemonBagEditor::handleEditInput(SDL_Keycode key) {
 // ============================================================================
 
 void PokemonBagEditor::render() {
-    SDL_SetRenderDrawColor(renderer, colors.background.r, colors.background.g, 
-                           colors.background.b, 255);
-    SDL_RenderClear(renderer);
+    clearDirtyRegions(colors.background);
 
     int headerH = charHeight * 2 + 10;
     SDL_Rect headerRect = {0, 0, windowWidth, headerH};
@@ -1552,6 +1085,9 @@ void PokemonBagEditor::render() {
     size_t endIndex = std::min(startIndex + scrollbar.visibleItems, 
                                static_cast<size_t>(pocket.capacity));
     
+    int suggestionX = 0;
+    int suggestionY = -1;
+    
     for (size_t idx = startIndex; idx < endIndex; idx++) {
         size_t local = idx - startIndex;
         int y = startY + static_cast<int>(local) * rowH;
@@ -1621,6 +1157,10 @@ void PokemonBagEditor::render() {
                 line += "_";
             } else if (editingField == 2) {
                 line += "  Name: ";
+                int prefixW, prefixH;
+                getTextSize(line, prefixW, prefixH);
+                suggestionX = rowRect.x + 5 + prefixW;
+                suggestionY = y + rowH;
                 line += editBuffer;
                 line += "_";
             }
@@ -1630,6 +1170,16 @@ void PokemonBagEditor::render() {
         renderText(line, rowRect.x + 5, y + 2, textColor);
     }
     
+    // Completions drop down over the slots below the one being edited
+    if (editing && editingField == 2 && nameSuggestionCount > 0 && suggestionY >= 0) {
+        std::array<std::string_view, MAX_NAME_SUGGESTIONS> names;
+        for (size_t i = 0; i < nameSuggestionCount; i++) {
+            names[i] = nameSuggestions[i].name;
+        }
+        renderSuggestionList(suggestionX, suggestionY, names.data(), nameSuggestionCount,
+                             selectedSuggestion);
+    }
+    
     if (scrollbar.canScroll()) {
         renderScrollbar();
     }
@@ -1646,10 +1196,11 @@ void PokemonBagEditor::render() {
     if (pocket.nameEditable) {
         inst1 << "I: Name  ";
     }
+    if (editing && editingField == 2) {
+        inst1.str("Type a name  Up/Down: Pick  Tab: Complete  Enter: Apply  Esc: Cancel");
+    }
     renderText(inst1.str(), 10, instrY, colors.textDim);
     renderText("Ctrl/Cmd+S: Save", 10, instrY + charHeight, colors.textDim);
-    
-    SDL_RenderPresent(renderer);
 }
 
 // ============================================================================
@@ -5,10 +5,13 @@
 #include "../common/data_utils.h"
 #include "../common/hex_utils.h"
 #include "../common/generation3_utils.h"
+#include "../common/game_layouts.h"
+#include "../common/patch_writer.h"
 #include "../encodings/items_index_eng.h"
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <array>
 
 class PokemonBagEditor : public SDLAppBase {
 public:
@@ -46,6 +49,7 @@ private:
     std::string fileBuffer;
     std::string fileName;
     size_t fileSize{0};
+    PatchList filePatches;  // pocket and checksum bytes rewritten on save
     std::string gameName;
     GameType gameType{GameType::UNKNOWN};
 
@@ -64,6 +68,12 @@ private:
     int editingField{0};  // 0 = ID, 1 = quantity, 2 = name
     std::string editBuffer;
     SDL_Rect saveButtonRect{};
+
+    // Completions shown while editing by name, refreshed as editBuffer changes
+    static constexpr size_t MAX_NAME_SUGGESTIONS = 6;
+    std::array<NameIndex::Entry, MAX_NAME_SUGGESTIONS> nameSuggestions{};
+    size_t nameSuggestionCount{0};
+    size_t selectedSuggestion{0};
     bool saveButtonHovered{false};
 
     // Gen 3 specific data
@@ -87,9 +97,11 @@ private:
     void writeGen3PocketToBuffer(const PocketInfo& pocket);
     bool isGen3Game() const;
 
+    // Save layout (pockets, checksums) of a game type
+    static GameLayouts::Layout layoutFor(GameType type, bool japanese);
+
     // Checksum updaters
-    void updateChecksumGen1();
-    void updateChecksumGen2();
+    void updateChecksumGameBoy();
     void updateChecksumGen3();
     void updateChecksum();
 
@@ -105,6 +117,8 @@ private:
     void shiftCurrentPocket();
     bool itemExistsForPocket(uint16_t id, const PocketInfo& pocket) const;
     const char* getItemName(uint16_t id) const;
+    NameIndex::Range getItemNameIndex() const;
+    void updateNameSuggestions();
     uint16_t lookupItemIdByName(const std::string& name, const PocketInfo& pocket) const;
 
 protected:
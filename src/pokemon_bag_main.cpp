@@ -14,6 +14,7 @@ static void printUsage(const char* progName) {
     std::cerr << "                 Gen 2: gold, silver, crystal" << std::endl;
     std::cerr << "                 Gen 3: ruby, sapphire, emerald, firered, leafgreen" << std::endl;
     std::cerr << "               Aliases: rs, e, frlg" << std::endl;
+    std::cerr << "               auto: detect the game and language from the save" << std::endl;
     std::cerr << std::endl;
     std::cerr << "Options:" << std::endl;
     std::cerr << "  -j          Use Japanese offsets (Gen 1/2 only)" << std::endl;
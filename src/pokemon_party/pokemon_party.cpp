@@ -1,4 +1,5 @@
 #include "pokemon_party.h"
+#include "../common/game_detect.h"
 
 #include <fstream>
 #include <sstream>
@@ -52,6 +53,17 @@ bool PokemonPartyEditor::setGame(const std::string& game) {
     gameName.clear();
     generation = 0;
     
+    if (g == GameDetect::AUTO_GAME) {
+        GameDetect::Result detected = GameDetect::detect(fileBuffer);
+        if (!detected.found()) {
+            std::cerr << "Could not detect the game of " << fileName << "; pass it explicitly" << std::endl;
+            return false;
+        }
+        std::cout << "Detected game: " << detected.description << (detected.japanese ? " (Japanese)" : "") << std::endl;
+        isJapanese = detected.japanese;
+        return setGame(detected.game);
+    }
+    
     // Determine game type
     if (g == "red" || g == "blue" || g == "yellow" || g == "green" ||
         g == "pokemon_red" || g == "pokemon_blue" || g == "pokemon_yellow" || 
@@ -78,6 +90,7 @@ bool PokemonPartyEditor::setGame(const std::string& game) {
         std::cerr << "Supported games:" << std::endl;
         std::cerr << "  Gen 1: red, blue, yellow, green" << std::endl;
         std::cerr << "  Gen 2: gold, silver, crystal" << std::endl;
+        std::cerr << "  auto (detect from the save)" << std::endl;
         return false;
     }
 
@@ -115,19 +128,22 @@ void PokemonPartyEditor::setEncodingForGame() {
     }
 }
 
-size_t PokemonPartyEditor::getPartyOffset() const {
+GameLayouts::Layout PokemonPartyEditor::getLayout() const {
     switch (gameType) {
-        case GameType::GEN1:
-            return isJapanese ? GEN1_PARTY_OFFSET_JPN : GEN1_PARTY_OFFSET_ENG;
-        case GameType::GEN2_GS:
-            return isJapanese ? GEN2_GS_PARTY_OFFSET_JPN : GEN2_GS_PARTY_OFFSET_ENG;
-        case GameType::GEN2_CRYSTAL:
-            return isJapanese ? GEN2_CRYSTAL_PARTY_OFFSET_JPN : GEN2_CRYSTAL_PARTY_OFFSET_ENG;
-        default:
-            return 0;
+        case GameType::GEN2_GS:      return GameLayouts::layoutOf(GameLayouts::Game::GOLD_SILVER, isJapanese);
+        case GameType::GEN2_CRYSTAL: return GameLayouts::layoutOf(GameLayouts::Game::CRYSTAL, isJapanese);
+        case GameType::GEN3_RS:      return GameLayouts::Layout::RUBY_SAPPHIRE;
+        case GameType::GEN3_EMERALD: return GameLayouts::Layout::EMERALD;
+        case GameType::GEN3_FRLG:    return GameLayouts::Layout::FIRERED_LEAFGREEN;
+        default:                     return GameLayouts::layoutOf(GameLayouts::Game::GEN1, isJapanese);
     }
 }
 
+size_t PokemonPartyEditor::getPartyOffset() const {
+    if (gameType == GameType::UNKNOWN) return 0;
+    return GameLayouts::get(getLayout()).partyOffset;
+}
+
 size_t PokemonPartyEditor::getPokemonDataSize() const {
     return (generation == 1) ? GEN1_POKEMON_DATA_SIZE : GEN2_POKEMON_DATA_SIZE;
 }
@@ -199,11 +215,7 @@ void PokemonPartyEditor::parsePokemonData() {
         }
         
         size_t offset = otNamesOffset + (i * nameLength);
-        std::vector<uint8_t> nameBytes(nameLength);
-        for (size_t j = 0; j < nameLength; j++) {
-            nameBytes[j] = DataUtils::readU8(fileBuffer, offset + j);
-        }
-        partyPokemon[i].otName = decodeText(nameBytes, encoding);
+        partyPokemon[i].otName = decodeText(std::string_view(fileBuffer).substr(offset, nameLength), encoding);
     }
     
     // Read nicknames
@@ -214,11 +226,7 @@ void PokemonPartyEditor::parsePokemonData() {
         }
         
         size_t offset = nicknamesOffset + (i * nameLength);
-        std::vector<uint8_t> nameBytes(nameLength);
-        for (size_t j = 0; j < nameLength; j++) {
-            nameBytes[j] = DataUtils::readU8(fileBuffer, offset + j);
-        }
-        partyPokemon[i].nickname = decodeText(nameBytes, encoding);
+        partyPokemon[i].nickname = decodeText(std::string_view(fileBuffer).substr(offset, nameLength), encoding);
     }
 }
 
@@ -810,100 +818,43 @@ const char* PokemonPartyEditor::getItemName(uint8_t item) const {
 // Name lookup helpers
 // ============================================================================
 
-uint8_t PokemonPartyEditor::lookupPokemonIdByName(const std::string& name) const {
-    std::string query = name;
-    std::transform(query.begin(), query.end(), query.begin(), [](unsigned char c) {
-        return static_cast<char>(std::toupper(c));
-    });
-    
-    // Search through Pokemon based on generation
-    const std::unordered_map<uint8_t, PokemonIndex::PokemonInfo>* pokemonMap = nullptr;
-    
-    if (generation == 1) {
-        pokemonMap = &PokemonIndex::GEN1_POKEMON;
-    } else if (generation == 2) {
-        pokemonMap = &PokemonIndex::GEN2_POKEMON;
-    } else {
-        return 0;
-    }
-    
-    for (const auto& kv : *pokemonMap) {
-        const char* pokemonName = kv.second.name;
-        if (!pokemonName) continue;
-        
-        std::string nameStr(pokemonName);
-        std::transform(nameStr.begin(), nameStr.end(), nameStr.begin(), [](unsigned char c) {
-            return static_cast<char>(std::toupper(c));
-        });
-        
-        if (nameStr == query) {
-            return kv.first;
-        }
+NameIndex::Range PokemonPartyEditor::getNameIndex(EditField field) const {
+    if (field == EditField::SPECIES) {
+        if (generation == 1) return PokemonIndex::GEN1_POKEMON_NAMES;
+        if (generation == 2) return PokemonIndex::GEN2_POKEMON_NAMES;
+    } else if (field >= EditField::MOVE1 && field <= EditField::MOVE4) {
+        if (generation == 1) return PokemonMoves::GEN1_MOVE_NAMES;
+        if (generation == 2) return PokemonMoves::GEN2_MOVE_NAMES;
+    } else if (field == EditField::HELD_ITEM && generation == 2) {
+        if (gameType == GameType::GEN2_CRYSTAL) return ItemsIndex::GEN2_ITEM_NAMES_CRYSTAL;
+        return ItemsIndex::GEN2_ITEM_NAMES_GS;
     }
+    return {};
+}
+
+void PokemonPartyEditor::updateNameSuggestions() {
+    nameSuggestionCount = 0;
+    selectedSuggestion = 0;
+    if (!editing || !editingByName) return;
     
-    return 0;
+    NameIndex::Range index = getNameIndex(static_cast<EditField>(selectedField));
+    nameSuggestionCount = NameIndex::suggest(index, editBuffer, nameSuggestions.data(),
+                                             MAX_NAME_SUGGESTIONS);
+}
+
+uint8_t PokemonPartyEditor::lookupPokemonIdByName(const std::string& name) const {
+    const NameIndex::Entry* entry = NameIndex::find(getNameIndex(EditField::SPECIES), name);
+    return entry ? static_cast<uint8_t>(entry->id) : 0;
 }
 
 uint8_t PokemonPartyEditor::lookupMoveIdByName(const std::string& name) const {
-    std::string query = name;
-    std::transform(query.begin(), query.end(), query.begin(), [](unsigned char c) {
-        return static_cast<char>(std::toupper(c));
-    });
-    
-    // Use generation-appropriate move lookup
-    const std::unordered_map<uint8_t, const char*>* moveMap = nullptr;
-    
-    if (generation == 1) {
-        moveMap = &PokemonMoves::GEN1_MOVES;
-    } else if (generation == 2) {
-        moveMap = &PokemonMoves::GEN2_MOVES;
-    } else {
-        return 0;
-    }
-    
-    for (const auto& kv : *moveMap) {
-        const char* moveName = kv.second;
-        if (!moveName) continue;
-        
-        std::string nameStr(moveName);
-        std::transform(nameStr.begin(), nameStr.end(), nameStr.begin(), [](unsigned char c) {
-            return static_cast<char>(std::toupper(c));
-        });
-        
-        if (nameStr == query) {
-            return kv.first;
-        }
-    }
-    
-    return 0;
+    const NameIndex::Entry* entry = NameIndex::find(getNameIndex(EditField::MOVE1), name);
+    return entry ? static_cast<uint8_t>(entry->id) : 0;
 }
 
 uint8_t PokemonPartyEditor::lookupItemIdByName(const std::string& name) const {
-    if (generation != 2) return 0;
-    
-    std::string query = name;
-    std::transform(query.begin(), query.end(), query.begin(), [](unsigned char c) {
-        return static_cast<char>(std::toupper(c));
-    });
-    
-    bool isCrystal = (gameType == GameType::GEN2_CRYSTAL);
-    
-    // Search through Gen 2 items
-    for (const auto& kv : ItemsIndex::GEN2_ITEMS) {
-        const char* itemName = ItemsIndex::getGen2ItemName(kv.first, isCrystal);
-        if (!itemName) continue;
-        
-        std::string nameStr(itemName);
-        std::transform(nameStr.begin(), nameStr.end(), nameStr.begin(), [](unsigned char c) {
-            return static_cast<char>(std::toupper(c));
-        });
-        
-        if (nameStr == query) {
-            return kv.first;
-        }
-    }
-    
-    return 0;
+    const NameIndex::Entry* entry = NameIndex::find(getNameIndex(EditField::HELD_ITEM), name);
+    return entry ? static_cast<uint8_t>(entry->id) : 0;
 }
 
 // ============================================================================
@@ -965,6 +916,7 @@ void PokemonPartyEditor::startEditing(EditField field, bool byName) {
     editingByName = byName && isNameEditableField(field);
     selectedField = static_cast<int>(field);
     editBuffer.clear();
+    updateNameSuggestions();
     requestRedraw();
 }
 
@@ -975,6 +927,7 @@ void PokemonPartyEditor::handleEditInput(SDL_Keycode key) {
         editing = false;
         editingByName = false;
         editBuffer.clear();
+        updateNameSuggestions();
         requestRedraw();
         return;
     }
@@ -984,9 +937,30 @@ void PokemonPartyEditor::handleEditInput(SDL_Keycode key) {
         return;
     }
     
+    // Up/Down pick a completion, Tab copies it into the buffer
+    if (editingByName && nameSuggestionCount > 0) {
+        if (key == SDLK_DOWN) {
+            selectedSuggestion = (selectedSuggestion + 1) % nameSuggestionCount;
+            requestRedraw();
+            return;
+        }
+        if (key == SDLK_UP) {
+            selectedSuggestion = (selectedSuggestion + nameSuggestionCount - 1) % nameSuggestionCount;
+            requestRedraw();
+            return;
+        }
+        if (key == SDLK_TAB) {
+            editBuffer.assign(nameSuggestions[selectedSuggestion].name);
+            updateNameSuggestions();
+            requestRedraw();
+            return;
+        }
+    }
+    
     if (key == SDLK_BACKSPACE) {
         if (!editBuffer.empty()) {
             editBuffer.pop_back();
+            updateNameSuggestions();
             requestRedraw();
         }
         return;
@@ -1021,6 +995,7 @@ void PokemonPartyEditor::handleEditInput(SDL_Keycode key) {
         }
         
         editBuffer.push_back(c);
+        updateNameSuggestions();
         requestRedraw();
         return;
     }
@@ -1051,6 +1026,12 @@ void PokemonPartyEditor::commitEdit() {
     
     // Handle name-based editing
     if (editingByName && !editBuffer.empty()) {
+        // A partial or misspelled name takes the highlighted completion
+        if (nameSuggestionCount > 0 && editBuffer != "-" && editBuffer != "NONE" &&
+            !NameIndex::find(getNameIndex(field), editBuffer)) {
+            editBuffer.assign(nameSuggestions[selectedSuggestion].name);
+        }
+        
         if (field == EditField::SPECIES) {
             uint8_t id = lookupPokemonIdByName(editBuffer);
             if (id != 0) {
@@ -1060,6 +1041,7 @@ void PokemonPartyEditor::commitEdit() {
                 editing = false;
                 editingByName = false;
                 editBuffer.clear();
+                updateNameSuggestions();
                 requestRedraw();
                 return;
             }
@@ -1072,6 +1054,7 @@ void PokemonPartyEditor::commitEdit() {
                 editing = false;
                 editingByName = false;
                 editBuffer.clear();
+                updateNameSuggestions();
                 requestRedraw();
                 return;
             }
@@ -1084,6 +1067,7 @@ void PokemonPartyEditor::commitEdit() {
                 editing = false;
                 editingByName = false;
                 editBuffer.clear();
+                updateNameSuggestions();
                 requestRedraw();
                 return;
             }
@@ -1097,6 +1081,7 @@ void PokemonPartyEditor::commitEdit() {
     editing = false;
     editingByName = false;
     editBuffer.clear();
+    updateNameSuggestions();
     requestRedraw();
 }
 
@@ -1275,77 +1260,8 @@ bool PokemonPartyEditor::validateAndApplyEdit(int pokemonIndex, EditField field,
 // ============================================================================
 
 void PokemonPartyEditor::updateChecksum() {
-    if (generation == 1) {
-        updateChecksumGen1();
-    } else if (generation == 2) {
-        updateChecksumGen2();
-    }
-}
-
-void PokemonPartyEditor::updateChecksumGen1() {
-    size_t start = 0x2598;
-    size_t end = isJapanese ? 0x3593 : 0x3522;
-    size_t checksumPos = isJapanese ? 0x3594 : 0x3523;
-    if (end >= fileSize || checksumPos >= fileSize) return;
-    
-    uint32_t sum = 0;
-    for (size_t i = start; i <= end && i < fileSize; i++) {
-        sum += static_cast<uint8_t>(fileBuffer[i]);
-    }
-    uint8_t checksum = static_cast<uint8_t>(~(sum & 0xFF));
-    DataUtils::writeU8(fileBuffer, checksumPos, checksum);
-}
-
-void PokemonPartyEditor::updateChecksumGen2() {
-    auto update16BitChecksum = [&](uint32_t start, uint32_t end, uint32_t loc) {
-        uint32_t sum = 0;
-        for (uint32_t i = start; i <= end && i < fileSize; i++) {
-            sum += DataUtils::readU8(fileBuffer, i);
-        }
-        uint16_t checksum = sum & 0xFFFF;
-        if (loc + 1 < fileSize) {
-            DataUtils::writeU16LE(fileBuffer, loc, checksum);
-        }
-    };
-    
-    auto update16BitChecksumMulti = [&](const std::vector<std::pair<uint32_t,uint32_t>>& ranges,
-                                        uint32_t loc) {
-        uint32_t sum = 0;
-        for (const auto& range : ranges) {
-            for (uint32_t i = range.first; i <= range.second && i < fileSize; i++) {
-                sum += static_cast<uint8_t>(fileBuffer[i]);
-            }
-        }
-        uint16_t checksum = static_cast<uint16_t>(sum & 0xFFFF);
-        if (loc + 1 < fileSize) {
-            DataUtils::writeU16LE(fileBuffer, loc, checksum);
-        }
-    };
-
-    bool crystal = (gameType == GameType::GEN2_CRYSTAL);
-    if (!crystal) {
-        // Gold/Silver
-        if (isJapanese) {
-            update16BitChecksum(0x2009, 0x2C8B, 0x2D0D);
-            update16BitChecksum(0x7209, 0x7E8B, 0x7F0D);
-        } else {
-            update16BitChecksum(0x2009, 0x2D68, 0x2D69);
-            std::vector<std::pair<uint32_t,uint32_t>> ranges = {
-                {0x0C6B, 0x17EC},
-                {0x3D96, 0x3F3F},
-                {0x7E39, 0x7E6C}
-            };
-            update16BitChecksumMulti(ranges, 0x7E6D);
-        }
-    } else {
-        // Crystal
-        if (isJapanese) {
-            update16BitChecksum(0x2009, 0x2AE2, 0x2D0D);
-            update16BitChecksum(0x7209, 0x7CE2, 0x7F0D);
-        } else {
-            update16BitChecksum(0x2009, 0x2B82, 0x2D0D);
-            update16BitChecksum(0x1209, 0x1D82, 0x1F0D);
-        }
+    if (generation == 1 || generation == 2) {
+        GameLayouts::writeChecksums(getLayout(), fileBuffer, fileSize, [](size_t, size_t) {});
     }
 }
 
@@ -1407,9 +1323,7 @@ bool PokemonPartyEditor::saveFile() {
 // ============================================================================
 
 void PokemonPartyEditor::render() {
-   SDL_SetRenderDrawColor(renderer, colors.background.r, colors.background.g, 
-                          colors.background.b, 255);
-   SDL_RenderClear(renderer);
+   clearDirtyRegions(colors.background);
 
    int headerH = charHeight * 2 + 10;
    SDL_Rect headerRect = {0, 0, windowWidth, headerH};
@@ -1526,6 +1440,9 @@ void PokemonPartyEditor::render() {
    size_t endIndex = std::min(startIndex + scrollbar.visibleItems, 
                               static_cast<size_t>(fieldCount));
    
+   int suggestionX = 0;
+   int suggestionY = -1;
+   
    for (size_t idx = startIndex; idx < endIndex; idx++) {
        size_t local = idx - startIndex;
        int y = startY + static_cast<int>(local) * rowH;
@@ -1552,6 +1469,11 @@ void PokemonPartyEditor::render() {
            }
            editText += "_";
            renderText(editText, valueX, y + 2, colors.accent);
+           
+           int labelW, labelH;
+           getTextSize("Name: ", labelW, labelH);
+           suggestionX = valueX + labelW;
+           suggestionY = y + rowH;
        } else {
            SDL_Color valueColor = colors.text;
            if (currentPokemonIndex >= partyCount || partyPokemon[currentPokemonIndex].isEmpty()) {
@@ -1572,19 +1494,32 @@ void PokemonPartyEditor::render() {
        }
    }
    
+   // Completions drop down over the rows below the field being edited
+   if (editingByName && nameSuggestionCount > 0 && suggestionY >= 0) {
+       std::array<std::string_view, MAX_NAME_SUGGESTIONS> names;
+       for (size_t i = 0; i < nameSuggestionCount; i++) {
+           names[i] = nameSuggestions[i].name;
+       }
+       renderSuggestionList(suggestionX, suggestionY, names.data(), nameSuggestionCount,
+                            selectedSuggestion);
+   }
+   
    if (scrollbar.canScroll()) {
        renderScrollbar();
    }
    
    // Instructions
    int instrY = startY + static_cast<int>(visibleRows) * rowH + 10;
-   renderText("Up/Down: Select Field  Left/Right: Switch Pokemon  Enter: Edit  Ctrl/Cmd+S: Save", 
-              10, instrY, colors.textDim);
+   if (editingByName) {
+       renderText("Type a name  Up/Down: Pick  Tab: Complete  Enter: Apply  Esc: Cancel",
+                  10, instrY, colors.textDim);
+   } else {
+       renderText("Up/Down: Select Field  Left/Right: Switch Pokemon  Enter: Edit  Ctrl/Cmd+S: Save", 
+                  10, instrY, colors.textDim);
+   }
    std::string itemInstr = (generation >= 2) ? "I: Type name for Species/Moves/Items  Q/Esc: Quit" :
                                                 "I: Type name for Species/Moves  Q/Esc: Quit";
    renderText(itemInstr, 10, instrY + charHeight, colors.textDim);
-   
-   SDL_RenderPresent(renderer);
 }
 
 // ============================================================================
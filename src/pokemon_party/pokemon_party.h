@@ -4,6 +4,7 @@
 #include "../common/sdl_app_base.h"
 #include "../common/data_utils.h"
 #include "../common/hex_utils.h"
+#include "../common/game_layouts.h"
 #include "../encodings/pokemon_index_eng.h"
 #include "../encodings/moves_index_eng.h"
 #include "../encodings/types_index_eng.h"
@@ -27,16 +28,7 @@ public:
         GEN3_FRLG       // FireRed/LeafGreen
     };
 
-    // Gen 1 offsets
-    static constexpr size_t GEN1_PARTY_OFFSET_ENG = 0x2F2C;
-    static constexpr size_t GEN1_PARTY_OFFSET_JPN = 0x2ED5;
-    
-    // Gen 2 offsets
-    static constexpr size_t GEN2_GS_PARTY_OFFSET_ENG = 0x288A;
-    static constexpr size_t GEN2_GS_PARTY_OFFSET_JPN = 0x283E;
-    static constexpr size_t GEN2_CRYSTAL_PARTY_OFFSET_ENG = 0x2865;
-    static constexpr size_t GEN2_CRYSTAL_PARTY_OFFSET_JPN = 0x281A;
-    
+    // Party offsets and checksum ranges come from GameLayouts
     static constexpr size_t MAX_PARTY_SIZE = 6;
     
     // Data sizes vary by generation
@@ -152,11 +144,18 @@ private:
     bool editingByName{false};  // True when editing by name (via 'i' key)
     std::string editBuffer;
     SDL_Rect saveButtonRect{};
+
+    // Completions shown while editing by name, refreshed as editBuffer changes
+    static constexpr size_t MAX_NAME_SUGGESTIONS = 6;
+    std::array<NameIndex::Entry, MAX_NAME_SUGGESTIONS> nameSuggestions{};
+    size_t nameSuggestionCount{0};
+    size_t selectedSuggestion{0};
     bool saveButtonHovered{false};
 
     TextEncoding encoding;
     
     // Helper functions
+    GameLayouts::Layout getLayout() const;
     size_t getPartyOffset() const;
     size_t getPokemonDataSize() const;
     size_t getNameLength() const { return isJapanese ? NAME_LENGTH_JPN : NAME_LENGTH_ENG; }
@@ -164,8 +163,6 @@ private:
     void parsePokemonData();
     void writePokemonDataToBuffer();
     void updateChecksum();
-    void updateChecksumGen1();
-    void updateChecksumGen2();
     
     void setEncodingForGame();
 
@@ -186,6 +183,8 @@ private:
     bool validateAndApplyEdit(int pokemonIndex, EditField field, const std::string& value);
     
     // Name lookup helpers
+    NameIndex::Range getNameIndex(EditField field) const;
+    void updateNameSuggestions();
     uint8_t lookupPokemonIdByName(const std::string& name) const;
     uint8_t lookupMoveIdByName(const std::string& name) const;
     uint8_t lookupItemIdByName(const std::string& name) const;
@@ -12,6 +12,7 @@ static void printUsage(const char* progName) {
     std::cerr << "  <game>       Game name:" << std::endl;
     std::cerr << "                 Gen 1: red, blue, yellow, green" << std::endl;
     std::cerr << "                 Gen 2: gold, silver, crystal" << std::endl;
+    std::cerr << "               auto: detect the game and language from the save" << std::endl;
     std::cerr << std::endl;
     std::cerr << "Options:" << std::endl;
     std::cerr << "  -j          Use Japanese offsets" << std::endl;